@@ -9,57 +9,6258 @@
 // Header
 #include <array/array.h>
 
+// Platform dependent includes
+#ifdef _WIN64
+    #include <windows.h>
+#else
+    #include <pthread.h>
+    #include <unistd.h>
+#endif
+
+// Growth policy without flags
+#define ARRAY_GROWTH_POLICY_MASK ( ARRAY_GROWTH_USABLE_SIZE - 1 )
+
+// Frozen layouts and parallel ranges align to this many bytes
+#define ARRAY_CACHE_LINE 64
+
 // Structure definitions
 struct array_s
 {
-    size_t   count,         // Quantity of elements in array
-             max;           // Quantity of elements array can hold 
-    mutex    _lock;         // Locked when writing values
-    void    **p_p_elements; // Array contents
-};
+    size_t             count,         // Quantity of elements in array
+                       max,           // Quantity of elements array can hold 
+                       element_size;  // Bytes in each element
+    array_sync         sync;          // Synchronization strategy
+    mutex              _lock;         // Locked when writing values, unless unsynchronized
+    #ifdef _WIN64
+        SRWLOCK          _rwlock;     // Shared by readers, exclusive to writers
+    #else
+        pthread_rwlock_t _rwlock;     // Shared by readers, exclusive to writers
+    #endif
+    size_t             sequence;      // Odd while a sequence locked writer is active
+    array_growth       growth;        // Growth policy
+    size_t             increment;     // Elements added by a fixed growth policy
+    fn_array_growth   *pfn_growth;    // Called by a callback growth policy
+    double             shrink_below;  // Shrink when count falls below this fraction of max. Zero never shrinks
+    size_t             shrink_min;    // Never shrink below this capacity
+    void             **p_p_elements,  // Array contents
+                     **p_p_retired;   // Storage replaced while sequence locked
+    size_t             inline_bytes;  // Size of the inline storage
+    array_allocator    allocator;     // Allocates the array and its storage
+    fn_array_compare  *pfn_compare;   // Orders the elements of a sorted array. Null if the array is not sorted
+    void              *p_compare;     // Passed to pfn_compare
+    bool               by_value;      // Compare the pointers stored in the elements, instead of pointers to them
+    unsigned char     *p_frozen,      // Allocation holding the frozen layout. Null if not frozen
+                      *p_keys;        // Frozen elements in Eytzinger order, aligned to a cache line
+    size_t             frozen_count,  // Quantity of frozen elements
+                       frozen_at,     // Modification count when the array was frozen
+                       modifications; // Incremented each time the array is locked exclusively
+    _Alignas(max_align_t)
+    unsigned char      _inline[];     // Contents of small arrays, in the same allocation
+};
+
+struct array_arena_chunk_s
+{
+    struct array_arena_chunk_s *p_next; // The chunk allocated before this one
+    size_t                      size,   // Bytes of data in the chunk
+                                top;    // Bytes of data in use
+    _Alignas(max_align_t)
+    unsigned char               data[]; // Allocations, each after a header holding its size
+};
+
+struct array_arena_s
+{
+    struct array_arena_chunk_s *p_chunk;    // Chunk that new allocations come from
+    size_t                      chunk_size; // Bytes of data in each chunk
+    void                       *p_last;     // The most recent allocation, which may grow in place
+    array_allocator             allocator;  // Allocates from this arena
+};
+
+struct array_pool_s
+{
+    mutex    _lock;   // Locked while the pool is in use
+    array  **pp_free; // Released arrays, waiting to be reused
+    size_t   count,   // Quantity of released arrays
+             max,     // Quantity of released arrays the pool can hold
+             hits,    // Constructions served by a released array
+             misses;  // Constructions that allocated a new array
+};
+
+// Runs the indices from lower up to upper of a parallel job. Returns 1 on success, 0 on error
+typedef int (array_parallel_range)(void *p_context, size_t lower, size_t upper);
+
+struct array_parallel_range_s
+{
+    _Alignas(ARRAY_CACHE_LINE)
+    size_t next, // Next index to claim. Every participant claims from the front
+           end;  // One past the last index
+};
+
+struct array_parallel_job_s
+{
+    array_parallel_range          *pfn_range; // Runs a claimed range
+    void                          *p_context; // Passed to pfn_range
+    struct array_parallel_range_s *p_ranges;  // One range of indices per participant
+    size_t                         ranges,    // Quantity of ranges
+                                   grain,     // Indices claimed at a time
+                                   running;   // Workers still running the job
+    int                            status;    // Cleared by any range that fails
+};
+
+struct array_foreach_job_s
+{
+    array                     *p_array;     // The array
+    fn_array_foreach_parallel *pfn_foreach; // Called on each element
+    void                      *p_context;   // Passed to pfn_foreach
+    bool                       sized;       // Pass pointers to elements, instead of their values
+};
+
+struct array_sort_s
+{
+    fn_array_compare *pfn_compare;   // Orders two elements
+    void             *p_context;     // Passed to pfn_compare
+    size_t            element_size,  // Bytes in each element
+                      count,         // Quantity of elements
+                      width;         // Elements in each run of a parallel sort
+    bool              values,        // Compare the pointers stored in the elements, instead of pointers to them
+                      stable;        // Keep equal elements in order
+    unsigned char    *p_elements,    // The elements
+                     *p_source,      // Runs being merged
+                     *p_destination; // Merged runs
+};
+
+struct array_transform_s
+{
+    array            *p_array,        // The source
+                     *p_result;       // The destination of a map or filter
+    fn_array_map     *pfn_map;        // Computes each element of a map
+    fn_array_filter  *pfn_filter;     // Tests each element of a filter
+    fn_array_reduce  *pfn_reduce;     // Folds each element of a reduce
+    void             *p_context;      // Passed to each function
+    size_t            grain,          // Elements in each chunk
+                      result_size,    // Bytes in the accumulator of a reduce
+                     *p_offsets;      // Elements kept in each chunk of a filter, then where the chunk starts in the result
+    unsigned char    *p_keep,         // One flag per element of a filter
+                     *p_accumulators; // One accumulator per chunk of a reduce
+    const void       *p_identity;     // Initial value of each accumulator
+    bool              sized;          // Pass pointers to elements, instead of their values
+};
+
+enum array_pipeline_stage_e
+{
+    ARRAY_PIPELINE_FILTER, // Drops elements that fail a test
+    ARRAY_PIPELINE_MAP,    // Replaces each element with a computed one
+    ARRAY_PIPELINE_TAKE    // Passes a quantity of elements, then ends the pipeline
+};
+
+struct array_pipeline_stage_s
+{
+    enum array_pipeline_stage_e  kind;         // What the stage does
+    fn_array_filter             *pfn_filter;   // Tests each element of a filter
+    fn_array_map                *pfn_map;      // Computes each element of a map
+    void                        *p_context;    // Passed to pfn_filter or pfn_map
+    size_t                       element_size, // Bytes in each result of a map
+                                 limit,        // Elements a take passes
+                                 taken;        // Elements a take passed in the running terminal
+    unsigned char               *p_result;     // Result of a map for the current element
+    bool                         sized;        // A map passes pointers to its results, instead of the values they hold
+};
+
+struct array_pipeline_s
+{
+    array                         *p_array;  // The source
+    struct array_pipeline_stage_s *p_stages; // Stages, in the order they run
+    size_t                         count,    // Quantity of stages
+                                   max;      // Quantity of stages that fit
+    bool                           sized;    // The source passes pointers to elements, instead of their values
+};
+
+struct array_pipeline_terminal_s
+{
+    array                     *p_result;     // Collects the elements
+    void                      *p_value;      // The first element, or the accumulator of a reduce
+    fn_array_foreach_parallel *pfn_foreach;  // Called on each element
+    fn_array_reduce           *pfn_reduce;   // Folds each element
+    void                      *p_context;    // Passed to pfn_foreach or pfn_reduce
+    size_t                     count,        // Elements received
+                               element_size; // Bytes in each element that leaves the pipeline
+    bool                       sized;        // Elements that leave the pipeline are pointers to elements, instead of values
+};
+
+// Receives each element that leaves a pipeline. Returns 1 on success, 0 on error
+typedef int (array_pipeline_sink)(const void *const value, size_t index, struct array_pipeline_terminal_s *const p_terminal);
+
+// Ranges this small are sorted by insertion
+#define ARRAY_SORT_INSERTION 16
+
+// Arena allocations are aligned, and preceded by a header of this size
+#define ARRAY_ARENA_ALIGNMENT _Alignof(max_align_t)
+
+// Data
+static bool initialized = false;
+
+// Set on threads running a parallel job, so nested jobs run serially
+static _Thread_local bool array_in_parallel = false;
+
+#ifndef _WIN64
+
+// Worker threads for parallel jobs
+static struct
+{
+    pthread_once_t               once;       // Starts the workers on first use
+    pthread_mutex_t              submit,     // Held by the thread running a job
+                                 lock;       // Guards the rest of the structure
+    pthread_cond_t               wake,       // Signaled when a job is posted, or the workers stop
+                                 done;       // Signaled when the last worker finishes a job
+    pthread_t                   *p_threads;  // The workers
+    size_t                       size,       // Quantity of workers
+                                 generation; // Incremented for each job
+    struct array_parallel_job_s *p_job;      // The current job
+    bool                         stop;       // Set when the workers should exit
+} array_workers = 
+{
+    .once   = PTHREAD_ONCE_INIT,
+    .submit = PTHREAD_MUTEX_INITIALIZER,
+    .lock   = PTHREAD_MUTEX_INITIALIZER,
+    .wake   = PTHREAD_COND_INITIALIZER,
+    .done   = PTHREAD_COND_INITIALIZER
+};
+#endif
+
+// Static functions
+/** !
+ * Create the lock for an array's synchronization strategy
+ * 
+ * @param p_array the array
+ * 
+ * @return 1 on success, 0 on error
+ */
+static int array_lock_create ( array *const p_array )
+{
+
+    // Strategy
+    switch ( p_array->sync )
+    {
+
+        // Unsynchronized arrays have no lock
+        case ARRAY_SYNC_NONE:
+            return 1;
+
+        // Reader-writer lock
+        case ARRAY_SYNC_RWLOCK:
+            #ifdef _WIN64
+                InitializeSRWLock(&p_array->_rwlock);
+                return 1;
+            #else
+                return ( pthread_rwlock_init(&p_array->_rwlock, 0) == 0 );
+            #endif
+
+        // Mutex, or the writer side of a sequence lock
+        case ARRAY_SYNC_MUTEX:
+        case ARRAY_SYNC_SEQLOCK:
+        default:
+            return mutex_create(&p_array->_lock);
+    }
+}
+
+/** !
+ * Destroy the lock for an array's synchronization strategy
+ * 
+ * @param p_array the array
+ * 
+ * @return void
+ */
+static void array_lock_destroy ( array *const p_array )
+{
+
+    // Strategy
+    switch ( p_array->sync )
+    {
+
+        // Unsynchronized arrays have no lock
+        case ARRAY_SYNC_NONE:
+            break;
+
+        // Reader-writer lock
+        case ARRAY_SYNC_RWLOCK:
+            #ifndef _WIN64
+                pthread_rwlock_destroy(&p_array->_rwlock);
+            #endif
+            break;
+
+        // Mutex, or the writer side of a sequence lock
+        case ARRAY_SYNC_MUTEX:
+        case ARRAY_SYNC_SEQLOCK:
+        default:
+            mutex_destroy(&p_array->_lock);
+            break;
+    }
+
+    // Done
+    return;
+}
+
+/** !
+ * Lock an array for reading. Readers may share the array with other readers
+ * 
+ * @param p_array the array
+ * 
+ * @return void
+ */
+static inline void array_lock_shared ( array *const p_array )
+{
+
+    // Strategy
+    switch ( p_array->sync )
+    {
+
+        // Unsynchronized arrays have no lock
+        case ARRAY_SYNC_NONE:
+            break;
+
+        // Reader-writer lock
+        case ARRAY_SYNC_RWLOCK:
+            #ifdef _WIN64
+                AcquireSRWLockShared(&p_array->_rwlock);
+            #else
+                pthread_rwlock_rdlock(&p_array->_rwlock);
+            #endif
+            break;
+
+        // Mutex. Sequence locked readers that copy more than one element wait for writers here
+        case ARRAY_SYNC_MUTEX:
+        case ARRAY_SYNC_SEQLOCK:
+        default:
+            mutex_lock(&p_array->_lock);
+            break;
+    }
+
+    // Done
+    return;
+}
+
+/** !
+ * Unlock an array locked with array_lock_shared
+ * 
+ * @param p_array the array
+ * 
+ * @return void
+ */
+static inline void array_unlock_shared ( array *const p_array )
+{
+
+    // Strategy
+    switch ( p_array->sync )
+    {
+
+        // Unsynchronized arrays have no lock
+        case ARRAY_SYNC_NONE:
+            break;
+
+        // Reader-writer lock
+        case ARRAY_SYNC_RWLOCK:
+            #ifdef _WIN64
+                ReleaseSRWLockShared(&p_array->_rwlock);
+            #else
+                pthread_rwlock_unlock(&p_array->_rwlock);
+            #endif
+            break;
+
+        // Mutex
+        case ARRAY_SYNC_MUTEX:
+        case ARRAY_SYNC_SEQLOCK:
+        default:
+            mutex_unlock(&p_array->_lock);
+            break;
+    }
+
+    // Done
+    return;
+}
+
+/** !
+ * Lock an array for writing. Writers have the array to themselves
+ * 
+ * @param p_array the array
+ * 
+ * @return void
+ */
+static inline void array_lock_exclusive ( array *const p_array )
+{
+
+    // Strategy
+    switch ( p_array->sync )
+    {
+
+        // Unsynchronized arrays have no lock
+        case ARRAY_SYNC_NONE:
+            break;
+
+        // Reader-writer lock
+        case ARRAY_SYNC_RWLOCK:
+            #ifdef _WIN64
+                AcquireSRWLockExclusive(&p_array->_rwlock);
+            #else
+                pthread_rwlock_wrlock(&p_array->_rwlock);
+            #endif
+            break;
+
+        // Sequence lock
+        case ARRAY_SYNC_SEQLOCK:
+
+            // Writers exclude each other with the mutex
+            mutex_lock(&p_array->_lock);
+
+            // An odd sequence tells optimistic readers to retry ...
+            __atomic_store_n(&p_array->sequence, p_array->sequence + 1, __ATOMIC_RELAXED);
+
+            // ... and must be visible before any write to the array
+            __atomic_thread_fence(__ATOMIC_RELEASE);
+            break;
+
+        // Mutex
+        case ARRAY_SYNC_MUTEX:
+        default:
+            mutex_lock(&p_array->_lock);
+            break;
+    }
+
+    // Writers may change the elements, which makes a frozen search layout stale
+    p_array->modifications++;
+
+    // Done
+    return;
+}
+
+/** !
+ * Unlock an array locked with array_lock_exclusive
+ * 
+ * @param p_array the array
+ * 
+ * @return void
+ */
+static inline void array_unlock_exclusive ( array *const p_array )
+{
+
+    // Strategy
+    switch ( p_array->sync )
+    {
+
+        // Unsynchronized arrays have no lock
+        case ARRAY_SYNC_NONE:
+            break;
+
+        // Reader-writer lock
+        case ARRAY_SYNC_RWLOCK:
+            #ifdef _WIN64
+                ReleaseSRWLockExclusive(&p_array->_rwlock);
+            #else
+                pthread_rwlock_unlock(&p_array->_rwlock);
+            #endif
+            break;
+
+        // Sequence lock
+        case ARRAY_SYNC_SEQLOCK:
+
+            // An even sequence publishes every write to the array
+            __atomic_store_n(&p_array->sequence, p_array->sequence + 1, __ATOMIC_RELEASE);
+
+            // Let the next writer in
+            mutex_unlock(&p_array->_lock);
+            break;
+
+        // Mutex
+        case ARRAY_SYNC_MUTEX:
+        default:
+            mutex_unlock(&p_array->_lock);
+            break;
+    }
+
+    // Done
+    return;
+}
+
+/** !
+ * Resolve a signed index against a quantity of elements. If index is
+ * negative, index = count - |index|
+ * 
+ * @param count   the quantity of elements
+ * @param index   signed index
+ * @param p_index return
+ * 
+ * @return true if the index is in bounds, else false
+ */
+static inline bool array_index_resolve ( size_t count, signed index, size_t *const p_index )
+{
+
+    // Positive index
+    if ( index >= 0 )
+    {
+
+        // Bounds check
+        if ( (size_t) index >= count ) return false;
+
+        // Store the index
+        *p_index = (size_t) index;
+    }
+
+    // Negative index
+    else
+    {
+
+        // Initialized data
+        size_t magnitude = (size_t) -( (long long) index );
+
+        // Bounds check
+        if ( magnitude > count ) return false;
+
+        // Store the index
+        *p_index = count - magnitude;
+    }
+
+    // Success
+    return true;
+}
+
+/** !
+ * Allocate, reallocate or free memory with an allocator, or with 
+ * ARRAY_REALLOC if the allocator has no realloc function
+ * 
+ * @param p_allocator the allocator
+ * @param p_memory    the memory to reallocate, or null to allocate
+ * @param size        the new size in bytes, or zero to free
+ * 
+ * @return the memory on success, null on error or when freeing
+ */
+static void *array_allocator_realloc ( const array_allocator *const p_allocator, void *const p_memory, size_t size )
+{
+
+    // Default allocator
+    if ( p_allocator->pfn_realloc == (void *) 0 ) return ARRAY_REALLOC(p_memory, size);
+
+    // Free
+    if ( size == 0 && p_allocator->pfn_free != (void *) 0 )
+    {
+
+        // Free the memory
+        if ( p_memory ) p_allocator->pfn_free(p_allocator->p_context, p_memory);
+
+        // Done
+        return (void *) 0;
+    }
+
+    // Allocate or reallocate
+    return p_allocator->pfn_realloc(p_allocator->p_context, p_memory, size);
+}
+
+/** !
+ * Add a chunk to an arena
+ * 
+ * @param p_arena the arena
+ * @param size    the least bytes of data the chunk must hold
+ * 
+ * @return 1 on success, 0 on error
+ */
+static int array_arena_chunk_add ( array_arena *const p_arena, size_t size )
+{
+
+    // Initialized data
+    struct array_arena_chunk_s *p_chunk = 0;
+
+    // Chunks hold at least the arena's chunk size
+    if ( size < p_arena->chunk_size ) size = p_arena->chunk_size;
+
+    // Allocate the chunk
+    p_chunk = ARRAY_REALLOC(0, sizeof(struct array_arena_chunk_s) + size);
+
+    // Error check
+    if ( p_chunk == (void *) 0 ) goto no_mem;
+
+    // Link the chunk
+    p_chunk->p_next  = p_arena->p_chunk,
+    p_chunk->size    = size,
+    p_chunk->top     = 0;
+    p_arena->p_chunk = p_chunk;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+/** !
+ * Allocate, grow or free memory in an arena. Memory is only given back to 
+ * the arena when it is the most recent allocation, or when the arena is reset.
+ * The most recent allocation grows in place while its chunk has room.
+ * 
+ * @param p_context the arena
+ * @param p_memory  the memory to reallocate, or null to allocate
+ * @param size      the new size in bytes, or zero to free
+ * 
+ * @return the memory on success, null on error or when freeing
+ */
+static void *array_arena_realloc ( void *p_context, void *p_memory, size_t size )
+{
+
+    // Initialized data
+    array_arena                *p_arena  = p_context;
+    struct array_arena_chunk_s *p_chunk  = p_arena->p_chunk;
+    size_t                      aligned  = ( size + ARRAY_ARENA_ALIGNMENT - 1 ) & ~( ARRAY_ARENA_ALIGNMENT - 1 ),
+                                old_size = ( p_memory ) ? *(size_t *) ( (unsigned char *) p_memory - ARRAY_ARENA_ALIGNMENT ) : 0,
+                                offset   = 0;
+    void                       *p_new    = 0;
+
+    // The most recent allocation ...
+    if ( p_memory != (void *) 0 && p_memory == p_arena->p_last )
+    {
+
+        // ... starts here
+        offset = (size_t) ( (unsigned char *) p_memory - p_chunk->data );
+
+        // ... is given back when freed
+        if ( size == 0 )
+        {
+            p_chunk->top    = offset - ARRAY_ARENA_ALIGNMENT;
+            p_arena->p_last = (void *) 0;
+
+            // Done
+            return (void *) 0;
+        }
+
+        // ... and grows or shrinks in place, if the chunk has room
+        if ( offset + aligned <= p_chunk->size )
+        {
+            p_chunk->top = offset + aligned;
+            *(size_t *) ( (unsigned char *) p_memory - ARRAY_ARENA_ALIGNMENT ) = size;
+
+            // Success
+            return p_memory;
+        }
+    }
+
+    // Everything else is freed when the arena is reset
+    if ( size == 0 ) return (void *) 0;
+
+    // Add a chunk, if this one is full
+    if ( p_chunk == (void *) 0 || p_chunk->top + ARRAY_ARENA_ALIGNMENT + aligned > p_chunk->size )
+    {
+        if ( array_arena_chunk_add(p_arena, ARRAY_ARENA_ALIGNMENT + aligned) == 0 ) return (void *) 0;
+        p_chunk = p_arena->p_chunk;
+    }
+
+    // Bump the top of the chunk
+    p_new         = p_chunk->data + p_chunk->top + ARRAY_ARENA_ALIGNMENT;
+    p_chunk->top += ARRAY_ARENA_ALIGNMENT + aligned;
+
+    // Store the size
+    *(size_t *) ( (unsigned char *) p_new - ARRAY_ARENA_ALIGNMENT ) = size;
+
+    // Copy the old memory
+    if ( p_memory ) memcpy(p_new, p_memory, ( old_size < size ) ? old_size : size);
+
+    // This is the most recent allocation
+    p_arena->p_last = p_new;
+
+    // Success
+    return p_new;
+}
+
+/** !
+ * Compute the bytes of storage for a quantity of elements. Storage always 
+ * has room for one pointer, so retired storage can link the retired list.
+ * 
+ * @param element_size bytes in each element
+ * @param max          quantity of elements
+ * 
+ * @return bytes of storage
+ */
+static inline size_t array_storage_bytes ( size_t element_size, size_t max )
+{
+
+    // Success
+    return ( element_size * max < sizeof(void *) ) ? sizeof(void *) : element_size * max;
+}
+
+/** !
+ * Test if an array keeps its elements inside the array itself
+ * 
+ * @param p_array the array
+ * 
+ * @return true if the storage is inline, else false
+ */
+static inline bool array_storage_is_inline ( const array *const p_array )
+{
+
+    // Success
+    return (const void *) p_array->p_p_elements == (const void *) p_array->_inline;
+}
+
+/** !
+ * Get the address of an element in a sized array
+ * 
+ * @param p_array the array
+ * @param index   the index of the element
+ * 
+ * @return pointer to the element
+ */
+static inline void *array_element ( const array *const p_array, size_t index )
+{
+
+    // Success
+    return (unsigned char *) p_array->p_p_elements + index * p_array->element_size;
+}
+
+/** !
+ * Resize the element storage of an array. Call with the array locked exclusively.
+ * 
+ * Sequence locked readers may still be reading the old storage, so it is 
+ * retired instead of freed, and released when the array is destroyed. To 
+ * bound the retired storage, sequence locked heap storage never shrinks, and
+ * grows at least twice over, so the retired storage is always smaller than 
+ * the live storage.
+ * 
+ * Storage that fits in the inline storage lives inside the array. It spills
+ * to the heap when it outgrows the array, and moves back when it shrinks, 
+ * unless the array is sequence locked.
+ * 
+ * @param p_array the array
+ * @param max     the new quantity of elements the array can hold
+ * 
+ * @return 1 on success, 0 on error
+ */
+static int array_storage_resize ( array *const p_array, size_t max )
+{
+
+    // Error check. The bytes of storage must not overflow
+    if ( max > SIZE_MAX / p_array->element_size ) return 0;
+
+    // Sequence locked heap storage never shrinks, and grows at least twice over
+    if ( p_array->sync == ARRAY_SYNC_SEQLOCK && array_storage_is_inline(p_array) == false )
+    {
+
+        // Keep the storage instead of shrinking it
+        if ( max <= p_array->max ) return 1;
+
+        // Grow at least twice over
+        if ( max / 2 < p_array->max )
+            max = ( p_array->max > SIZE_MAX / p_array->element_size / 2 ) ? SIZE_MAX / p_array->element_size : p_array->max * 2;
+    }
+
+    // Initialized data
+    void   **p_p_elements = 0;
+    size_t   size         = array_storage_bytes(p_array->element_size, max),
+             live         = ( ( p_array->count < max ) ? p_array->count : max ) * p_array->element_size;
+    bool     was_inline   = array_storage_is_inline(p_array);
+
+    // Inline storage that still fits stays where it is
+    if ( was_inline && size <= p_array->inline_bytes )
+        p_p_elements = p_array->p_p_elements;
+
+    // Heap storage that fits moves inline, unless a sequence locked reader could be reading it
+    else if ( size <= p_array->inline_bytes && p_array->sync != ARRAY_SYNC_SEQLOCK )
+    {
+
+        // Copy the elements
+        memcpy(p_array->_inline, p_array->p_p_elements, live);
+
+        // Free the heap storage
+        p_p_elements = array_allocator_realloc(&p_array->allocator, p_array->p_p_elements, 0);
+
+        // Use the inline storage
+        p_p_elements = (void **) p_array->_inline;
+    }
+
+    // Inline storage spills to new heap storage
+    else if ( was_inline )
+    {
+
+        // Allocate heap storage
+        p_p_elements = array_allocator_realloc(&p_array->allocator, 0, size);
+
+        // Error check
+        if ( p_p_elements == (void *) 0 ) goto no_mem;
+
+        // Copy the elements. The inline storage lives as long as the array
+        memcpy(p_p_elements, p_array->p_p_elements, live);
+    }
+
+    // Sequence lock
+    else if ( p_array->sync == ARRAY_SYNC_SEQLOCK )
+    {
+
+        // Allocate new storage
+        p_p_elements = array_allocator_realloc(&p_array->allocator, 0, size);
+
+        // Error check
+        if ( p_p_elements == (void *) 0 ) goto no_mem;
+
+        // Copy the elements
+        memcpy(p_p_elements, p_array->p_p_elements, live);
+
+        // Retire the old storage. Its first slot links the retired list
+        p_array->p_p_elements[0] = (void *) p_array->p_p_retired;
+        p_array->p_p_retired     = p_array->p_p_elements;
+    }
+
+    // Everything else
+    else
+    {
+
+        // Reallocate the storage
+        p_p_elements = array_allocator_realloc(&p_array->allocator, p_array->p_p_elements, size);
+
+        // Error check
+        if ( p_p_elements == (void *) 0 ) goto no_mem;
+    }
+
+    // Use every byte the allocator reserved. Only ARRAY_REALLOC can report it
+    if ( p_array->growth & ARRAY_GROWTH_USABLE_SIZE && (void *) p_p_elements != (void *) p_array->_inline && p_array->allocator.pfn_realloc == (void *) 0 )
+        if ( ARRAY_USABLE_SIZE(p_p_elements) / p_array->element_size > max ) 
+            max = ARRAY_USABLE_SIZE(p_p_elements) / p_array->element_size;
+
+    // Publish the storage
+    __atomic_store_n(&p_array->p_p_elements, p_p_elements, __ATOMIC_RELEASE);
+
+    // Store the new max
+    __atomic_store_n(&p_array->max, max, __ATOMIC_RELAXED);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+/** !
+ * Grow the element storage of an array until it can hold a quantity of 
+ * elements. Call with the array locked exclusively
+ * 
+ * Growth stops at the largest capacity whose bytes fit in a size_t. If the
+ * grown storage can't be allocated, the storage grows to exactly required.
+ * 
+ * @param p_array  the array
+ * @param required the quantity of elements the array must hold
+ * 
+ * @return 1 on success, 0 on error
+ */
+static int array_storage_reserve ( array *const p_array, size_t required )
+{
+
+    // Initialized data
+    size_t max   = p_array->max,
+           limit = SIZE_MAX / p_array->element_size,
+           steps = 0;
+
+    // Fast exit
+    if ( required <= max ) return 1;
+
+    // Error check. The bytes of storage must not overflow
+    if ( required > limit ) return 0;
+
+    // Grow the size according to the policy, never past the limit
+    switch ( p_array->growth & ARRAY_GROWTH_POLICY_MASK )
+    {
+
+        // Grow by half until the elements fit
+        case ARRAY_GROWTH_HALF:
+            while ( max < required ) max = ( max / 2 > limit - max ) ? limit : max + ( ( max / 2 ) ? max / 2 : 1 );
+            break;
+
+        // Grow by the increment until the elements fit
+        case ARRAY_GROWTH_FIXED:
+            steps = ( required - max ) / p_array->increment + ( ( ( required - max ) % p_array->increment ) ? 1 : 0 );
+            max   = ( steps > ( limit - max ) / p_array->increment ) ? limit : max + steps * p_array->increment;
+            break;
+
+        // Ask the callback, and never take less than required
+        case ARRAY_GROWTH_CALLBACK:
+            max = p_array->pfn_growth(max, required);
+            if ( max < required ) max = required;
+            if ( max > limit    ) max = limit;
+            break;
+
+        // Double the size until the elements fit
+        case ARRAY_GROWTH_DOUBLE:
+        default:
+            while ( max < required ) max = ( max > limit / 2 ) ? limit : ( ( max ) ? max * 2 : 1 );
+            break;
+    }
+
+    // Resize the storage
+    if ( array_storage_resize(p_array, max) ) return 1;
+
+    // If the grown storage can't be allocated, take just enough
+    return ( max > required ) ? array_storage_resize(p_array, required) : 0;
+}
+
+/** !
+ * Shrink the element storage of an array, if its shrink policy allows. Call 
+ * with the array locked exclusively.
+ * 
+ * The storage shrinks to twice the count. Since the threshold is below one
+ * half, an array that oscillates around its count resizes at most once.
+ * 
+ * Sequence locked storage is retired instead of freed, so those arrays 
+ * never shrink.
+ * 
+ * @param p_array the array
+ * 
+ * @return void
+ */
+static void array_storage_trim ( array *const p_array )
+{
+
+    // Initialized data
+    size_t max = p_array->count * 2;
+
+    // Fast exit
+    if ( p_array->shrink_below <= 0          ) return;
+    if ( p_array->sync == ARRAY_SYNC_SEQLOCK ) return;
+    if ( (double) p_array->count >= p_array->shrink_below * (double) p_array->max ) return;
+
+    // Respect the minimum capacity
+    if ( max < p_array->shrink_min ) max = p_array->shrink_min;
+
+    // Nothing to give back
+    if ( max >= p_array->max ) return;
+
+    // Shrink the storage. On failure, the array keeps the larger storage
+    (void) array_storage_resize(p_array, max);
+
+    // Done
+    return;
+}
+
+/** !
+ * Free the storage retired by sequence locked writers. Call with no readers
+ * left on the array
+ * 
+ * @param p_array the array
+ * 
+ * @return void
+ */
+static void array_storage_free_retired ( array *const p_array )
+{
+
+    // Walk the retired list
+    while ( p_array->p_p_retired )
+    {
+
+        // Initialized data
+        void **p_p_next = (void **) p_array->p_p_retired[0];
+
+        // Free the storage
+        p_array->p_p_retired = array_allocator_realloc(&p_array->allocator, p_array->p_p_retired, 0);
+
+        // Next
+        p_array->p_p_retired = p_p_next;
+    }
+
+    // Done
+    return;
+}
+
+/** !
+ * Compare an element of a sorted array with a key
+ * 
+ * @param p_array   the sorted array
+ * @param p_element pointer to the element
+ * @param p_key     the key
+ * 
+ * @return negative if the element orders before the key, positive if after, else 0
+ */
+static inline int array_sorted_compare ( const array *const p_array, const void *const p_element, const void *const p_key )
+{
+
+    // Compare the pointer stored in the element
+    if ( p_array->by_value ) return p_array->pfn_compare(*(void *const *) p_element, p_key, p_array->p_compare);
+
+    // Compare the element
+    return p_array->pfn_compare(p_element, p_key, p_array->p_compare);
+}
+
+/** !
+ * Find the first element of a sorted array that does not order before a key.
+ * Call with the array locked.
+ * 
+ * The search halves the range without branching on the comparison, so its 
+ * latency does not depend on the key, and prefetches both elements the next 
+ * step could compare
+ * 
+ * @param p_array the sorted array
+ * @param p_key   the key
+ * 
+ * @return the index of the element, or the count if every element orders before the key
+ */
+static size_t array_sorted_lower_bound ( const array *const p_array, const void *const p_key )
+{
+
+    // Initialized data
+    const unsigned char *p_elements   = (const unsigned char *) p_array->p_p_elements,
+                        *p_base       = p_elements;
+    size_t               element_size = p_array->element_size,
+                         count        = p_array->count;
+
+    // Empty array
+    if ( count == 0 ) return 0;
+
+    // Halve the range until one element is left
+    while ( count > 1 )
+    {
+
+        // Initialized data
+        size_t half = count / 2,
+               next = ( count - half ) / 2;
+
+        // Prefetch the elements the next step could compare
+        __builtin_prefetch(p_base + next * element_size);
+        __builtin_prefetch(p_base + ( half + next ) * element_size);
+
+        // Skip the lower half if its last element orders before the key
+        p_base  = ( array_sorted_compare(p_array, p_base + half * element_size, p_key) < 0 ) ? p_base + half * element_size : p_base;
+        count  -= half;
+    }
+
+    // Success
+    return (size_t) ( p_base - p_elements ) / element_size + ( array_sorted_compare(p_array, p_base, p_key) < 0 );
+}
+
+/** !
+ * Open a slot for a key at its lower bound in a sorted array, moving the 
+ * following elements up by one. Call with the array locked exclusively, 
+ * and room for another element
+ * 
+ * @param p_array the sorted array
+ * @param p_key   the key
+ * 
+ * @return the index of the slot
+ */
+static size_t array_sorted_open ( array *const p_array, const void *const p_key )
+{
+
+    // Initialized data
+    size_t index = array_sorted_lower_bound(p_array, p_key);
+
+    // Move the following elements up
+    memmove(array_element(p_array, index + 1), array_element(p_array, index), ( p_array->count - index ) * p_array->element_size);
+
+    // Success
+    return index;
+}
+
+/** !
+ * Compute the rank of the element in a slot of a frozen layout, from the 
+ * shape of the tree alone. Slot 0 is unused, so the children of slot k are 
+ * 2k and 2k + 1, and every level but the last is full
+ * 
+ * @param count quantity of elements
+ * @param slot  the slot
+ * 
+ * @return the rank
+ */
+static inline size_t array_frozen_rank ( size_t count, size_t slot )
+{
+
+    // Initialized data
+    size_t depth   = (size_t) ( 63 - __builtin_clzll(slot) ),
+           below   = (size_t) ( 63 - __builtin_clzll(count) ) - depth,
+           present = count - ( (size_t) 1 << ( depth + below ) ) + 1,
+           rank    = ( ( ( slot - ( (size_t) 1 << depth ) ) * 2 + 1 ) << below ) - 1,
+           missing = ( rank + 1 ) / 2;
+
+    // Success, less the slots of the last level that precede the slot in a full tree but are absent
+    return rank - ( ( missing > present ) ? missing - present : 0 );
+}
+
+/** !
+ * Test if the frozen layout of an array matches its elements. Call with the array locked
+ * 
+ * @param p_array the array
+ * 
+ * @return true if the layout can be searched, else false
+ */
+static inline bool array_frozen_is_fresh ( const array *const p_array )
+{
+
+    // Success
+    return p_array->p_frozen && p_array->frozen_at == p_array->modifications && p_array->frozen_count == p_array->count;
+}
+
+/** !
+ * Copy the sorted elements of an array into a subtree of its frozen layout,
+ * in order
+ * 
+ * @param p_array the array
+ * @param slot    the root of the subtree
+ * @param rank    rank of the first element of the subtree
+ * 
+ * @return rank of the first element after the subtree
+ */
+static size_t array_frozen_fill ( array *const p_array, size_t slot, size_t rank )
+{
+
+    // Empty subtree
+    if ( slot > p_array->count ) return rank;
+
+    // Fill the left subtree
+    rank = array_frozen_fill(p_array, 2 * slot, rank);
+
+    // Copy the element
+    memcpy(p_array->p_keys + slot * p_array->element_size, array_element(p_array, rank), p_array->element_size);
+
+    // Fill the right subtree
+    return array_frozen_fill(p_array, 2 * slot + 1, rank + 1);
+}
+
+/** !
+ * Find the rank of the first element of a frozen layout that does not order
+ * before a key. Call with the array locked, and a fresh layout.
+ * 
+ * Each step descends one level of the tree without branching on the 
+ * comparison. The descendants a few levels down share one cache line, which
+ * is prefetched, so a search misses the cache once every few levels instead
+ * of once per level
+ * 
+ * @param p_array the array
+ * @param p_key   the key
+ * 
+ * @return the rank, or the count if every element orders before the key
+ */
+static size_t array_frozen_lower_bound ( const array *const p_array, const void *const p_key )
+{
+
+    // Initialized data
+    size_t element_size = p_array->element_size,
+           slot         = 1,
+           ahead        = 1;
+
+    // Look ahead as many levels as fit in a cache line
+    while ( ( (size_t) 2 << ahead ) * element_size <= ARRAY_CACHE_LINE ) ahead++;
+
+    // Descend to a leaf
+    while ( slot <= p_array->count )
+    {
+
+        // Prefetch the descendants
+        __builtin_prefetch(p_array->p_keys + ( slot << ahead ) * element_size);
+
+        // Go right if the element orders before the key
+        slot = 2 * slot + ( array_sorted_compare(p_array, p_array->p_keys + slot * element_size, p_key) < 0 );
+    }
+
+    // Climb to the last slot where the search went left. None means every element orders before the key
+    slot >>= __builtin_ffsll((long long) ~slot);
+
+    // Success
+    return ( slot ) ? array_frozen_rank(p_array->count, slot) : p_array->count;
+}
+
+/** !
+ * Find the first element of a sorted array that does not order before a key,
+ * in the frozen layout if it is fresh, else by binary search. Call with the
+ * array locked
+ * 
+ * @param p_array the sorted array
+ * @param p_key   the key
+ * 
+ * @return the index of the element, or the count if every element orders before the key
+ */
+static inline size_t array_sorted_search ( const array *const p_array, const void *const p_key )
+{
+
+    // Success
+    return ( array_frozen_is_fresh(p_array) ) ? array_frozen_lower_bound(p_array, p_key) : array_sorted_lower_bound(p_array, p_key);
+}
+
+/** !
+ * Order indices from largest to smallest, for qsort
+ * 
+ * @param p_a pointer to a size_t
+ * @param p_b pointer to a size_t
+ * 
+ * @return negative if a is larger than b, positive if a is smaller than b, else 0
+ */
+static int array_index_compare_descending ( const void *p_a, const void *p_b )
+{
+
+    // Initialized data
+    size_t a = *(const size_t *) p_a,
+           b = *(const size_t *) p_b;
+
+    // Success
+    return ( a < b ) - ( a > b );
+}
+
+/** !
+ * Allocate a zeroed array, followed by inline storage in the same allocation
+ * 
+ * @param pp_array     return
+ * @param inline_bytes size of the inline storage
+ * @param p_allocator  the allocator, or null for ARRAY_REALLOC
+ * 
+ * @return 1 on success, 0 on error
+ */
+static int array_allocate ( array **const pp_array, size_t inline_bytes, const array_allocator *const p_allocator )
+{
+
+    // Argument check
+    if ( pp_array == (void *) 0 ) goto no_array;
+
+    // Initialized data
+    array_allocator allocator = { 0 };
+
+    // Use the caller's allocator, if any
+    if ( p_allocator ) allocator = *p_allocator;
+
+    // Allocate memory for an array, followed by its inline storage
+    array *p_array = array_allocator_realloc(&allocator, 0, sizeof(array) + inline_bytes);
+
+    // Error checking
+    if ( p_array == (void *) 0 ) goto no_mem;
+
+    // Zero set
+    memset(p_array, 0, sizeof(array));
+
+    // Store the size of the inline storage, and the allocator
+    p_array->inline_bytes = inline_bytes,
+    p_array->allocator    = allocator;
+
+    // Return the allocated memory
+    *pp_array = p_array;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_array:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for parameter \"pp_array\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error 
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+                
+                // Error
+                return 0;
+        }
+    }
+}
+
+/** !
+ * Construct an array with a given quantity of inline storage
+ * 
+ * @param pp_array     return
+ * @param size         number of elements in an array
+ * @param element_size bytes in each element
+ * @param sync         the synchronization strategy
+ * @param inline_bytes size of the inline storage
+ * @param p_allocator  the allocator, or null for ARRAY_REALLOC
+ * 
+ * @return 1 on success, 0 on error
+ */
+static int array_construct_storage ( array **const pp_array, size_t size, size_t element_size, array_sync sync, size_t inline_bytes, const array_allocator *const p_allocator )
+{
+
+    // Argument check
+    if ( pp_array     == (void *) 0              ) goto no_array;
+    if ( size         == 0                       ) goto zero_size;
+    if ( element_size == 0                       ) goto zero_element_size;
+    if ( size         >  SIZE_MAX / element_size ) goto size_too_large;
+    if ( sync         >  ARRAY_SYNC_NONE         ) goto bad_sync;
+
+    // Initialized data
+    array           *p_array   = 0;
+    array_allocator  allocator = { 0 };
+
+    // Allocate an array
+    if ( array_allocate(&p_array, inline_bytes, p_allocator) == 0 ) goto failed_to_create_array;
+    
+    // Set the count, max, element size, and synchronization strategy
+    p_array->count        = 0,
+    p_array->max          = size,
+    p_array->element_size = element_size,
+    p_array->sync         = sync;
+
+    // Small arrays keep their elements inline ...
+    if ( array_storage_bytes(element_size, size) <= inline_bytes )
+        p_array->p_p_elements = (void **) p_array->_inline;
+
+    // ... everything else allocates "size" number of properties
+    else
+        p_array->p_p_elements = array_allocator_realloc(&p_array->allocator, 0, array_storage_bytes(element_size, size));
+
+    // Error checking
+    if ( p_array->p_p_elements == (void *) 0 ) goto no_mem;
+
+    // Create a lock
+    if ( array_lock_create(p_array) == 0 ) goto failed_to_create_lock;
+
+    // Return a pointer to the caller
+    *pp_array = p_array;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_array:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for parameter \"pp_array\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error 
+                return 0;
+
+            zero_size:
+                #ifndef NDEBUG
+                    log_error("[array] Zero provided for parameter \"size\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error 
+                return 0;   
+
+            zero_element_size:
+                #ifndef NDEBUG
+                    log_error("[array] Zero provided for parameter \"element_size\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error 
+                return 0;   
+
+            size_too_large:
+                #ifndef NDEBUG
+                    log_error("[array] Parameter \"size\" is too large for the element size in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error 
+                return 0;   
+
+            bad_sync:
+                #ifndef NDEBUG
+                    log_error("[array] Parameter \"sync\" must be a valid synchronization strategy in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error 
+                return 0;   
+        }
+
+        // Array errors
+        {
+            failed_to_create_array:
+                #ifndef NDEBUG
+                    log_error("[array] Failed to create array in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error 
+                return 0;
+            
+            failed_to_create_lock:
+                #ifndef NDEBUG
+                    log_error("[array] Failed to create lock in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Free the array contents, unless they are inline
+                if ( array_storage_is_inline(p_array) == false )
+                    p_array->p_p_elements = array_allocator_realloc(&p_array->allocator, p_array->p_p_elements, 0);
+
+                // Free the array with a copy of its allocator
+                allocator = p_array->allocator;
+                p_array   = array_allocator_realloc(&allocator, p_array, 0);
+
+                // Error 
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Free the array with a copy of its allocator
+                allocator = p_array->allocator;
+                p_array   = array_allocator_realloc(&allocator, p_array, 0);
+
+                // Error 
+                return 0;
+        }
+    }
+}
+
+/** !
+ * Claim and run ranges of a parallel job until every range is exhausted. 
+ * Each participant starts on its own range, then steals from the others
+ * 
+ * @param p_job the job
+ * @param id    the participant
+ * 
+ * @return void
+ */
+static void array_parallel_run ( struct array_parallel_job_s *const p_job, size_t id )
+{
+
+    // Visit every range, starting with this participant's own
+    for (size_t i = 0; i < p_job->ranges; i++)
+    {
+
+        // Initialized data
+        struct array_parallel_range_s *p_range = &p_job->p_ranges[( id + i ) % p_job->ranges];
+
+        // Claim from the front until the range is exhausted
+        for (;;)
+        {
+
+            // Initialized data
+            size_t lower = __atomic_fetch_add(&p_range->next, p_job->grain, __ATOMIC_RELAXED),
+                   upper = 0;
+
+            // Exhausted
+            if ( lower >= p_range->end ) break;
+
+            // Clamp the claim to the range
+            upper = ( p_range->end - lower < p_job->grain ) ? p_range->end : lower + p_job->grain;
+
+            // Run the claim
+            if ( p_job->pfn_range(p_job->p_context, lower, upper) == 0 )
+                __atomic_store_n(&p_job->status, 0, __ATOMIC_RELAXED);
+        }
+    }
+
+    // Done
+    return;
+}
+
+#ifndef _WIN64
+
+/** !
+ * Run each job posted to the workers, until the workers stop
+ * 
+ * @param p_parameter the participant
+ * 
+ * @return null
+ */
+static void *array_worker ( void *p_parameter )
+{
+
+    // Initialized data
+    size_t id         = (size_t) p_parameter,
+           generation = 0;
+
+    // Nested jobs run serially
+    array_in_parallel = true;
+
+    for (;;)
+    {
+
+        // Initialized data
+        struct array_parallel_job_s *p_job = 0;
+
+        // Wait for a job
+        pthread_mutex_lock(&array_workers.lock);
+        while ( array_workers.generation == generation && array_workers.stop == false )
+            pthread_cond_wait(&array_workers.wake, &array_workers.lock);
+
+        // Exit
+        if ( array_workers.stop ) break;
+
+        // Take the job
+        generation = array_workers.generation,
+        p_job      = array_workers.p_job;
+        pthread_mutex_unlock(&array_workers.lock);
+
+        // Run the job
+        array_parallel_run(p_job, id);
+
+        // The last worker out wakes the thread that posted the job
+        pthread_mutex_lock(&array_workers.lock);
+        if ( --p_job->running == 0 ) pthread_cond_signal(&array_workers.done);
+        pthread_mutex_unlock(&array_workers.lock);
+    }
+
+    // Unlock
+    pthread_mutex_unlock(&array_workers.lock);
+
+    // Done
+    return (void *) 0;
+}
+
+/** !
+ * Start one worker per processor, or ARRAY_PARALLEL_THREADS workers, less the
+ * thread that posts jobs. If some workers fail to start, jobs run on the rest
+ * 
+ * @param void
+ * 
+ * @return void
+ */
+static void array_workers_start ( void )
+{
+
+    // Initialized data
+    long   processors = ( ARRAY_PARALLEL_THREADS ) ? (long) ARRAY_PARALLEL_THREADS : sysconf(_SC_NPROCESSORS_ONLN);
+    size_t size       = ( processors > 1 ) ? (size_t) processors - 1 : 0;
+
+    // Single processor, or the library is exiting
+    if ( size == 0 || array_workers.stop ) return;
+
+    // Allocate the workers
+    array_workers.p_threads = ARRAY_REALLOC(0, size * sizeof(pthread_t));
+
+    // Error check
+    if ( array_workers.p_threads == (void *) 0 ) return;
+
+    // Start the workers. The thread that posts a job is participant 0
+    for (array_workers.size = 0; array_workers.size < size; array_workers.size++)
+        if ( pthread_create(&array_workers.p_threads[array_workers.size], (void *) 0, array_worker, (void *) ( array_workers.size + 1 )) ) break;
+
+    // Done
+    return;
+}
+
+/** !
+ * Stop the workers
+ * 
+ * @param void
+ * 
+ * @return void
+ */
+static void array_workers_stop ( void )
+{
+
+    // Wake every worker
+    pthread_mutex_lock(&array_workers.lock);
+    array_workers.stop = true;
+    pthread_cond_broadcast(&array_workers.wake);
+    pthread_mutex_unlock(&array_workers.lock);
+
+    // Wait for them to exit
+    for (size_t i = 0; i < array_workers.size; i++)
+        pthread_join(array_workers.p_threads[i], (void *) 0);
+
+    // Free the workers. Later jobs run serially
+    array_workers.size      = 0;
+    array_workers.p_threads = ARRAY_REALLOC(array_workers.p_threads, 0);
+
+    // Done
+    return;
+}
+#endif
+
+/** !
+ * Get the quantity of threads a parallel job would run on, starting the 
+ * workers on first use
+ * 
+ * @param void
+ * 
+ * @return the quantity of threads, including the caller
+ */
+static size_t array_parallel_threads ( void )
+{
+
+    #ifdef _WIN64
+
+        // Serial
+        return 1;
+    #else
+
+        // Start the workers on first use
+        pthread_once(&array_workers.once, array_workers_start);
+
+        // Nested jobs run serially
+        return ( array_in_parallel ) ? 1 : array_workers.size + 1;
+    #endif
+}
+
+/** !
+ * Run a range of indices in parallel, on the workers and the calling thread.
+ * Runs serially on a single processor, on a thread already running a job, or
+ * when the range is no more than one grain
+ * 
+ * @param count     quantity of indices
+ * @param grain     indices claimed at a time
+ * @param pfn_range runs a claimed range
+ * @param p_context passed to pfn_range
+ * 
+ * @return 1 if every range succeeded, else 0
+ */
+static int array_parallel_for ( size_t count, size_t grain, array_parallel_range *pfn_range, void *p_context )
+{
+
+    // Initialized data
+    struct array_parallel_job_s job = 
+    {
+        .pfn_range = pfn_range,
+        .p_context = p_context,
+        .grain     = ( grain ) ? grain : ARRAY_PARALLEL_GRAIN,
+        .status    = 1
+    };
+
+    #ifdef _WIN64
+
+        // Run serially
+        return pfn_range(p_context, 0, count);
+    #else
+
+        // Initialized data
+        void *p_allocation = 0;
+
+        // Start the workers on first use
+        pthread_once(&array_workers.once, array_workers_start);
+
+        // Run serially
+        if ( array_in_parallel || array_workers.size == 0 || count <= job.grain )
+            return pfn_range(p_context, 0, count);
+
+        // One range per participant, and no more ranges than grains
+        job.ranges = array_workers.size + 1;
+        if ( job.ranges > ( count + job.grain - 1 ) / job.grain ) job.ranges = ( count + job.grain - 1 ) / job.grain;
+
+        // Allocate the ranges. ARRAY_REALLOC only aligns to max_align_t, so align them to a cache line by hand
+        p_allocation = ARRAY_REALLOC(0, ARRAY_CACHE_LINE - 1 + job.ranges * sizeof(struct array_parallel_range_s));
+
+        // Run serially if there is no memory
+        if ( p_allocation == (void *) 0 ) return pfn_range(p_context, 0, count);
+
+        // Align the ranges
+        job.p_ranges = (struct array_parallel_range_s *) ( ( (uintptr_t) p_allocation + ARRAY_CACHE_LINE - 1 ) & ~(uintptr_t) ( ARRAY_CACHE_LINE - 1 ) );
+
+        // Split the indices evenly
+        for (size_t i = 0, lower = 0; i < job.ranges; i++)
+        {
+
+            // Initialized data
+            size_t size = count / job.ranges + ( ( i < count % job.ranges ) ? 1 : 0 );
+
+            // Store the range
+            job.p_ranges[i].next = lower,
+            job.p_ranges[i].end  = lower + size;
+
+            // Next
+            lower += size;
+        }
+
+        // One job at a time
+        pthread_mutex_lock(&array_workers.submit);
+
+        // Post the job
+        pthread_mutex_lock(&array_workers.lock);
+        job.running         = array_workers.size,
+        array_workers.p_job = &job;
+        array_workers.generation++;
+        pthread_cond_broadcast(&array_workers.wake);
+        pthread_mutex_unlock(&array_workers.lock);
+
+        // Take part in the job
+        array_in_parallel = true;
+        array_parallel_run(&job, 0);
+        array_in_parallel = false;
+
+        // Wait for the workers
+        pthread_mutex_lock(&array_workers.lock);
+        while ( job.running ) pthread_cond_wait(&array_workers.done, &array_workers.lock);
+        pthread_mutex_unlock(&array_workers.lock);
+
+        // Let the next job run
+        pthread_mutex_unlock(&array_workers.submit);
+
+        // Free the ranges
+        p_allocation = ARRAY_REALLOC(p_allocation, 0);
+
+        // Done
+        return job.status;
+    #endif
+}
+
+/** !
+ * Call a parallel foreach function on a range of elements
+ * 
+ * @param p_context the foreach job
+ * @param lower     the first index
+ * @param upper     one past the last index
+ * 
+ * @return 1 if every call succeeded, else 0
+ */
+static int array_foreach_parallel_range ( void *p_context, size_t lower, size_t upper )
+{
+
+    // Initialized data
+    struct array_foreach_job_s *p_foreach = p_context;
+    int                         status    = 1;
+
+    // Call the function on each element in the range
+    for (size_t i = lower; i < upper; i++)
+        if ( p_foreach->pfn_foreach(( p_foreach->sized ) ? array_element(p_foreach->p_array, i) : p_foreach->p_array->p_p_elements[i], i, p_foreach->p_context) == 0 )
+            status = 0;
+
+    // Done
+    return status;
+}
+
+/** !
+ * Compare two elements of a sort
+ * 
+ * @param p_sort the sort
+ * @param p_a    pointer to the first element
+ * @param p_b    pointer to the second element
+ * 
+ * @return negative if a orders before b, positive if b orders before a, else 0
+ */
+static inline int array_sort_compare ( const struct array_sort_s *const p_sort, const void *const p_a, const void *const p_b )
+{
+
+    // Compare the pointers stored in the elements
+    if ( p_sort->values ) return p_sort->pfn_compare(*(void *const *) p_a, *(void *const *) p_b, p_sort->p_context);
+
+    // Compare the elements
+    return p_sort->pfn_compare(p_a, p_b, p_sort->p_context);
+}
+
+/** !
+ * Exchange two elements
+ * 
+ * @param element_size bytes in each element
+ * @param p_a          pointer to the first element
+ * @param p_b          pointer to the second element
+ * 
+ * @return void
+ */
+static inline void array_sort_swap ( size_t element_size, void *const p_a, void *const p_b )
+{
+
+    // Initialized data
+    unsigned char *p_x = p_a,
+                  *p_y = p_b;
+
+    // Exchange pointer sized elements in one step
+    if ( element_size == sizeof(void *) )
+    {
+
+        // Initialized data
+        void *p_t = 0;
+
+        // Swap
+        memcpy(&p_t, p_x, sizeof(void *)),
+        memcpy(p_x, p_y, sizeof(void *)),
+        memcpy(p_y, &p_t, sizeof(void *));
+
+        // Done
+        return;
+    }
+
+    // Exchange larger elements a piece at a time
+    while ( element_size )
+    {
+
+        // Initialized data
+        unsigned char _t[64];
+        size_t        size = ( element_size < sizeof(_t) ) ? element_size : sizeof(_t);
+
+        // Swap
+        memcpy(_t, p_x, size),
+        memcpy(p_x, p_y, size),
+        memcpy(p_y, _t, size);
+
+        // Next
+        p_x += size,
+        p_y += size,
+        element_size -= size;
+    }
+
+    // Done
+    return;
+}
+
+/** !
+ * Sort a few elements by insertion. Equal elements keep their order
+ * 
+ * @param p_sort the sort
+ * @param p_base the first element
+ * @param count  quantity of elements
+ * 
+ * @return void
+ */
+static void array_sort_insertion ( const struct array_sort_s *const p_sort, unsigned char *const p_base, size_t count )
+{
+
+    // Initialized data
+    size_t element_size = p_sort->element_size;
+
+    // Sink each element into the sorted prefix
+    for (size_t i = 1; i < count; i++)
+        for (size_t j = i; j > 0 && array_sort_compare(p_sort, p_base + j * element_size, p_base + ( j - 1 ) * element_size) < 0; j--)
+            array_sort_swap(element_size, p_base + j * element_size, p_base + ( j - 1 ) * element_size);
+
+    // Done
+    return;
+}
+
+/** !
+ * Sift an element down a max heap
+ * 
+ * @param p_sort the sort
+ * @param p_base the first element of the heap
+ * @param root   the index of the element
+ * @param size   quantity of elements in the heap
+ * 
+ * @return void
+ */
+static void array_sort_sift ( const struct array_sort_s *const p_sort, unsigned char *const p_base, size_t root, size_t size )
+{
+
+    // Initialized data
+    size_t element_size = p_sort->element_size;
+
+    // Walk down the heap
+    for (;;)
+    {
+
+        // Initialized data
+        size_t child = 2 * root + 1;
+
+        // Leaf
+        if ( child >= size ) break;
+
+        // Take the larger child
+        if ( child + 1 < size && array_sort_compare(p_sort, p_base + child * element_size, p_base + ( child + 1 ) * element_size) < 0 ) child++;
+
+        // Heap order holds
+        if ( array_sort_compare(p_sort, p_base + root * element_size, p_base + child * element_size) >= 0 ) break;
+
+        // Swap, and continue down
+        array_sort_swap(element_size, p_base + root * element_size, p_base + child * element_size);
+        root = child;
+    }
+
+    // Done
+    return;
+}
+
+/** !
+ * Sort elements with a heap. Used when quicksort recurses too deeply
+ * 
+ * @param p_sort the sort
+ * @param p_base the first element
+ * @param count  quantity of elements
+ * 
+ * @return void
+ */
+static void array_sort_heap ( const struct array_sort_s *const p_sort, unsigned char *const p_base, size_t count )
+{
+
+    // Build a max heap
+    for (size_t i = count / 2; i-- > 0;)
+        array_sort_sift(p_sort, p_base, i, count);
+
+    // Move the largest element past the end of the heap, until the heap is empty
+    for (size_t end = count; end-- > 1;)
+    {
+        array_sort_swap(p_sort->element_size, p_base, p_base + end * p_sort->element_size);
+        array_sort_sift(p_sort, p_base, 0, end);
+    }
+
+    // Done
+    return;
+}
+
+/** !
+ * Compute the depth limit of introsort, twice the base two logarithm of count
+ * 
+ * @param count quantity of elements
+ * 
+ * @return the depth limit
+ */
+static inline size_t array_sort_depth ( size_t count )
+{
+
+    // Initialized data
+    size_t depth = 0;
+
+    // Count the bits
+    while ( count >>= 1 ) depth += 2;
+
+    // Success
+    return depth;
+}
+
+/** !
+ * Sort elements with introsort: quicksort with a median of three pivot, 
+ * falling back to heapsort past a depth limit, and to insertion sort on 
+ * small ranges
+ * 
+ * @param p_sort the sort
+ * @param p_base the first element
+ * @param count  quantity of elements
+ * @param depth  partitions left before falling back to heapsort
+ * 
+ * @return void
+ */
+static void array_sort_intro ( const struct array_sort_s *const p_sort, unsigned char *p_base, size_t count, size_t depth )
+{
+
+    // Initialized data
+    size_t element_size = p_sort->element_size;
+
+    // Partition until the range is small
+    while ( count > ARRAY_SORT_INSERTION )
+    {
+
+        // Initialized data
+        unsigned char *p_low  = p_base + element_size,
+                      *p_mid  = p_base + ( count / 2 ) * element_size,
+                      *p_high = p_base + ( count - 1 ) * element_size;
+        size_t         i      = 1,
+                       j      = count - 1;
+
+        // Too deep
+        if ( depth == 0 ) { array_sort_heap(p_sort, p_base, count); return; }
+        depth--;
+
+        // Order the low, middle and high elements. The low and high elements bound the scans below
+        if ( array_sort_compare(p_sort, p_mid,  p_low) < 0 ) array_sort_swap(element_size, p_mid, p_low);
+        if ( array_sort_compare(p_sort, p_high, p_mid) < 0 )
+        {
+            array_sort_swap(element_size, p_high, p_mid);
+            if ( array_sort_compare(p_sort, p_mid, p_low) < 0 ) array_sort_swap(element_size, p_mid, p_low);
+        }
+
+        // The median is the pivot
+        array_sort_swap(element_size, p_base, p_mid);
+
+        // Partition around the pivot. Scans stop on equal elements, which keeps duplicates balanced
+        for (;;)
+        {
+            do i++; while ( array_sort_compare(p_sort, p_base + i * element_size, p_base) < 0 );
+            do j--; while ( array_sort_compare(p_sort, p_base, p_base + j * element_size) < 0 );
+            if ( i >= j ) break;
+            array_sort_swap(element_size, p_base + i * element_size, p_base + j * element_size);
+        }
+
+        // Place the pivot
+        array_sort_swap(element_size, p_base, p_base + j * element_size);
+
+        // Recurse into the smaller side, and loop on the larger side
+        if ( j < count - j - 1 )
+        {
+            array_sort_intro(p_sort, p_base, j, depth);
+            p_base += ( j + 1 ) * element_size,
+            count  -= j + 1;
+        }
+        else
+        {
+            array_sort_intro(p_sort, p_base + ( j + 1 ) * element_size, count - j - 1, depth);
+            count = j;
+        }
+    }
+
+    // Finish small ranges by insertion
+    array_sort_insertion(p_sort, p_base, count);
+
+    // Done
+    return;
+}
+
+/** !
+ * Merge two sorted runs. Equal elements take the left run first
+ * 
+ * @param p_sort        the sort
+ * @param p_left        the left run
+ * @param left          quantity of elements in the left run
+ * @param p_right       the right run, which follows the left run
+ * @param right         quantity of elements in the right run
+ * @param p_destination return, left + right elements
+ * 
+ * @return void
+ */
+static void array_sort_merge ( const struct array_sort_s *const p_sort, const unsigned char *p_left, size_t left, const unsigned char *p_right, size_t right, unsigned char *p_destination )
+{
+
+    // Initialized data
+    size_t element_size = p_sort->element_size;
+
+    // Take the smaller head until one run is empty
+    while ( left && right )
+    {
+
+        // Take the right head only if it is strictly smaller
+        if ( array_sort_compare(p_sort, p_right, p_left) < 0 )
+            memcpy(p_destination, p_right, element_size),
+            p_right += element_size,
+            right--;
+        else
+            memcpy(p_destination, p_left, element_size),
+            p_left += element_size,
+            left--;
+
+        // Next
+        p_destination += element_size;
+    }
+
+    // Copy the rest
+    memcpy(p_destination, p_left, left * element_size);
+    memcpy(p_destination + left * element_size, p_right, right * element_size);
+
+    // Done
+    return;
+}
+
+/** !
+ * Sort elements with a bottom up merge sort. Equal elements keep their order
+ * 
+ * @param p_sort    the sort
+ * @param p_base    the first element
+ * @param p_scratch room for count elements
+ * @param count     quantity of elements
+ * 
+ * @return void
+ */
+static void array_sort_merge_sort ( const struct array_sort_s *const p_sort, unsigned char *const p_base, unsigned char *const p_scratch, size_t count )
+{
+
+    // Initialized data
+    size_t         element_size  = p_sort->element_size;
+    unsigned char *p_source      = p_base,
+                  *p_destination = p_scratch;
+
+    // Sort short runs by insertion
+    for (size_t i = 0; i < count; i += ARRAY_SORT_INSERTION)
+        array_sort_insertion(p_sort, p_base + i * element_size, ( count - i < ARRAY_SORT_INSERTION ) ? count - i : ARRAY_SORT_INSERTION);
+
+    // Merge pairs of runs, doubling the run length each pass
+    for (size_t width = ARRAY_SORT_INSERTION; width < count; width *= 2)
+    {
+
+        // Initialized data
+        unsigned char *p_t = p_source;
+
+        // Merge each pair
+        for (size_t i = 0; i < count; i += 2 * width)
+        {
+
+            // Initialized data
+            size_t left  = ( count - i < width ) ? count - i : width,
+                   right = ( count - i - left < width ) ? count - i - left : width;
+
+            // Merge
+            array_sort_merge(p_sort, p_source + i * element_size, left, p_source + ( i + left ) * element_size, right, p_destination + i * element_size);
+        }
+
+        // The destination is the next source
+        p_source      = p_destination,
+        p_destination = p_t;
+    }
+
+    // Copy the result back
+    if ( p_source != p_base ) memcpy(p_base, p_source, count * element_size);
+
+    // Done
+    return;
+}
+
+/** !
+ * Sort blocks of a parallel sort
+ * 
+ * @param p_context the sort
+ * @param lower     the first block
+ * @param upper     one past the last block
+ * 
+ * @return 1
+ */
+static int array_sort_block_range ( void *p_context, size_t lower, size_t upper )
+{
+
+    // Initialized data
+    const struct array_sort_s *p_sort = p_context;
+
+    // Sort each block
+    for (size_t i = lower; i < upper; i++)
+    {
+
+        // Initialized data
+        size_t first = i * p_sort->width,
+               count = 0;
+
+        // Rounding up the quantity of blocks can leave the last blocks empty
+        if ( first >= p_sort->count ) break;
+
+        // The last block may be short
+        count = ( p_sort->count - first < p_sort->width ) ? p_sort->count - first : p_sort->width;
+
+        // Sort the block
+        if ( p_sort->stable ) array_sort_merge_sort(p_sort, p_sort->p_source + first * p_sort->element_size, p_sort->p_destination + first * p_sort->element_size, count);
+        else                  array_sort_intro(p_sort, p_sort->p_source + first * p_sort->element_size, count, array_sort_depth(count));
+    }
+
+    // Success
+    return 1;
+}
+
+/** !
+ * Merge pairs of runs of a parallel sort
+ * 
+ * @param p_context the sort
+ * @param lower     the first pair
+ * @param upper     one past the last pair
+ * 
+ * @return 1
+ */
+static int array_sort_merge_range ( void *p_context, size_t lower, size_t upper )
+{
+
+    // Initialized data
+    const struct array_sort_s *p_sort = p_context;
+
+    // Merge each pair
+    for (size_t i = lower; i < upper; i++)
+    {
+
+        // Initialized data
+        size_t first = 2 * i * p_sort->width,
+               left  = ( p_sort->count - first < p_sort->width ) ? p_sort->count - first : p_sort->width,
+               right = ( p_sort->count - first - left < p_sort->width ) ? p_sort->count - first - left : p_sort->width;
+
+        // Merge
+        array_sort_merge(p_sort, p_sort->p_source + first * p_sort->element_size, left, p_sort->p_source + ( first + left ) * p_sort->element_size, right, p_sort->p_destination + first * p_sort->element_size);
+    }
+
+    // Success
+    return 1;
+}
+
+/** !
+ * Sort the elements of an array. Call with the array locked exclusively.
+ * 
+ * Large arrays are split into one block per thread. The blocks are sorted in 
+ * parallel, then merged pairwise in parallel, one level at a time
+ * 
+ * @param p_sort the sort
+ * 
+ * @return 1 on success, 0 on error
+ */
+static int array_sort_elements ( struct array_sort_s *const p_sort )
+{
+
+    // Initialized data
+    size_t         threads   = ( p_sort->count >= ARRAY_SORT_PARALLEL_THRESHOLD ) ? array_parallel_threads() : 1,
+                   blocks    = 1;
+    unsigned char *p_scratch = 0;
+
+    // Nothing to sort
+    if ( p_sort->count < 2 ) return 1;
+
+    // Small unstable sorts need no scratch memory
+    if ( p_sort->stable == false && threads == 1 )
+    {
+
+        // Sort
+        array_sort_intro(p_sort, p_sort->p_elements, p_sort->count, array_sort_depth(p_sort->count));
+
+        // Success
+        return 1;
+    }
+
+    // Allocate scratch memory
+    p_scratch = ARRAY_REALLOC(0, p_sort->count * p_sort->element_size);
+
+    // Error check
+    if ( p_scratch == (void *) 0 )
+    {
+
+        // Stable sorts need the scratch memory
+        if ( p_sort->stable ) goto no_mem;
+
+        // Unstable sorts fall back to one thread
+        array_sort_intro(p_sort, p_sort->p_elements, p_sort->count, array_sort_depth(p_sort->count));
+
+        // Success
+        return 1;
+    }
+
+    // One block per thread, rounded up to a power of two so merges pair evenly
+    while ( blocks < threads ) blocks *= 2;
+
+    // Sort each block
+    p_sort->width         = ( p_sort->count + blocks - 1 ) / blocks,
+    p_sort->p_source      = p_sort->p_elements,
+    p_sort->p_destination = p_scratch;
+    (void) array_parallel_for(blocks, 1, array_sort_block_range, p_sort);
+
+    // Merge pairs of blocks, doubling the run length each level
+    for (; p_sort->width < p_sort->count; p_sort->width *= 2)
+    {
+
+        // Initialized data
+        unsigned char *p_t = p_sort->p_source;
+
+        // Merge each pair
+        (void) array_parallel_for(( p_sort->count + 2 * p_sort->width - 1 ) / ( 2 * p_sort->width ), 1, array_sort_merge_range, p_sort);
+
+        // The destination is the next source
+        p_sort->p_source      = p_sort->p_destination,
+        p_sort->p_destination = p_t;
+    }
+
+    // Copy the result back
+    if ( p_sort->p_source != p_sort->p_elements ) memcpy(p_sort->p_elements, p_sort->p_source, p_sort->count * p_sort->element_size);
+
+    // Free the scratch memory
+    p_scratch = ARRAY_REALLOC(p_scratch, 0);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+/** !
+ * Sort an array under its exclusive lock
+ * 
+ * @param p_array     the array
+ * @param pfn_compare orders two elements
+ * @param p_context   passed to pfn_compare
+ * @param values      compare the pointers stored in the elements, instead of pointers to them
+ * @param stable      keep equal elements in order
+ * 
+ * @return 1 on success, 0 on error
+ */
+static int array_sort_locked ( array *const p_array, fn_array_compare *pfn_compare, void *const p_context, bool values, bool stable )
+{
+
+    // Initialized data
+    struct array_sort_s sort = 
+    {
+        .pfn_compare = pfn_compare,
+        .p_context   = p_context,
+        .values      = values,
+        .stable      = stable
+    };
+    int result = 0;
+
+    // Lock
+    array_lock_exclusive(p_array);
+
+    // Sort the elements in place
+    sort.element_size = p_array->element_size,
+    sort.count        = p_array->count,
+    sort.p_elements   = (unsigned char *) p_array->p_p_elements;
+    result            = array_sort_elements(&sort);
+
+    // Unlock
+    array_unlock_exclusive(p_array);
+
+    // Done
+    return result;
+}
+
+/** !
+ * Get the value a transform passes to its function for an element
+ * 
+ * @param p_transform the transform
+ * @param index       the index of the element
+ * 
+ * @return the value stored in the element, or a pointer to it if the transform is sized
+ */
+static inline const void *array_transform_value ( const struct array_transform_s *const p_transform, size_t index )
+{
+
+    // Success
+    return ( p_transform->sized ) ? array_element(p_transform->p_array, index) : p_transform->p_array->p_p_elements[index];
+}
+
+/** !
+ * Compute a range of the elements of a map
+ * 
+ * @param p_context the transform
+ * @param lower     the first index
+ * @param upper     one past the last index
+ * 
+ * @return 1 if every call succeeded, else 0
+ */
+static int array_map_range ( void *p_context, size_t lower, size_t upper )
+{
+
+    // Initialized data
+    struct array_transform_s *p_transform = p_context;
+    int                       status      = 1;
+
+    // Write each result into its slot of the result
+    for (size_t i = lower; i < upper; i++)
+        if ( p_transform->pfn_map(array_transform_value(p_transform, i), i, array_element(p_transform->p_result, i), p_transform->p_context) == 0 )
+            status = 0;
+
+    // Done
+    return status;
+}
+
+/** !
+ * Test the elements of a range of chunks of a filter, and count the elements
+ * each chunk keeps
+ * 
+ * @param p_context the transform
+ * @param lower     the first chunk
+ * @param upper     one past the last chunk
+ * 
+ * @return 1
+ */
+static int array_filter_test_range ( void *p_context, size_t lower, size_t upper )
+{
+
+    // Initialized data
+    struct array_transform_s *p_transform = p_context;
+    size_t                    count       = p_transform->p_array->count;
+
+    // Each chunk
+    for (size_t c = lower; c < upper; c++)
+    {
+
+        // Initialized data
+        size_t first = c * p_transform->grain,
+               last  = ( count - first < p_transform->grain ) ? count : first + p_transform->grain,
+               kept  = 0;
+
+        // Test each element
+        for (size_t i = first; i < last; i++)
+            p_transform->p_keep[i] = p_transform->pfn_filter(array_transform_value(p_transform, i), i, p_transform->p_context) != 0,
+            kept                  += p_transform->p_keep[i];
+
+        // Store the count
+        p_transform->p_offsets[c] = kept;
+    }
+
+    // Success
+    return 1;
+}
+
+/** !
+ * Copy the kept elements of a range of chunks of a filter to where each chunk
+ * starts in the result
+ * 
+ * @param p_context the transform
+ * @param lower     the first chunk
+ * @param upper     one past the last chunk
+ * 
+ * @return 1
+ */
+static int array_filter_copy_range ( void *p_context, size_t lower, size_t upper )
+{
+
+    // Initialized data
+    struct array_transform_s *p_transform  = p_context;
+    size_t                    count        = p_transform->p_array->count,
+                              element_size = p_transform->p_array->element_size;
+
+    // Each chunk
+    for (size_t c = lower; c < upper; c++)
+    {
+
+        // Initialized data
+        size_t first  = c * p_transform->grain,
+               last   = ( count - first < p_transform->grain ) ? count : first + p_transform->grain,
+               offset = p_transform->p_offsets[c];
+
+        // Copy each kept element
+        for (size_t i = first; i < last; i++)
+            if ( p_transform->p_keep[i] )
+                memcpy(array_element(p_transform->p_result, offset++), array_element(p_transform->p_array, i), element_size);
+    }
+
+    // Success
+    return 1;
+}
+
+/** !
+ * Fold the elements of a range of chunks of a reduce into the accumulator of
+ * each chunk
+ * 
+ * @param p_context the transform
+ * @param lower     the first chunk
+ * @param upper     one past the last chunk
+ * 
+ * @return 1 if every call succeeded, else 0
+ */
+static int array_reduce_range ( void *p_context, size_t lower, size_t upper )
+{
+
+    // Initialized data
+    struct array_transform_s *p_transform = p_context;
+    size_t                    count       = p_transform->p_array->count;
+    int                       status      = 1;
+
+    // Each chunk
+    for (size_t c = lower; c < upper; c++)
+    {
+
+        // Initialized data
+        unsigned char *p_accumulator = p_transform->p_accumulators + c * p_transform->result_size;
+        size_t         first         = c * p_transform->grain,
+                       last          = ( count - first < p_transform->grain ) ? count : first + p_transform->grain;
+
+        // Start from the identity
+        memcpy(p_accumulator, p_transform->p_identity, p_transform->result_size);
+
+        // Fold each element
+        for (size_t i = first; i < last; i++)
+            if ( p_transform->pfn_reduce(p_accumulator, array_transform_value(p_transform, i), i, p_transform->p_context) == 0 )
+                status = 0;
+    }
+
+    // Done
+    return status;
+}
+
+/** !
+ * Map an array into a new array under the shared lock of the source. Each 
+ * result is written into its slot of the new array, so no output lock is 
+ * taken
+ * 
+ * @param p_array      the source
+ * @param pp_result    return
+ * @param element_size bytes in each element of the new array
+ * @param pfn_map      computes each element
+ * @param p_context    passed to pfn_map
+ * @param grain        elements claimed at a time
+ * @param sized        pass pointers to elements, instead of their values
+ * 
+ * @return 1 on success, 0 on error
+ */
+static int array_map_locked ( array *const p_array, array **const pp_result, size_t element_size, fn_array_map *pfn_map, void *const p_context, size_t grain, bool sized )
+{
+
+    // Initialized data
+    struct array_transform_s map = 
+    {
+        .p_array   = p_array,
+        .pfn_map   = pfn_map,
+        .p_context = p_context,
+        .sized     = sized
+    };
+    int result = 0;
+
+    // Lock
+    array_lock_shared(p_array);
+
+    // Construct the result with room for exactly one element per element
+    if ( array_construct_sized_sync(&map.p_result, ( p_array->count ) ? p_array->count : 1, element_size, p_array->sync) == 0 ) goto done;
+
+    // Compute the elements, in parallel
+    result = array_parallel_for(p_array->count, grain, array_map_range, &map);
+
+    // Fill the result, or discard it on error
+    if ( result ) map.p_result->count = p_array->count, *pp_result = map.p_result;
+    else          (void) array_destroy(&map.p_result);
+
+    done:
+
+    // Unlock
+    array_unlock_shared(p_array);
+
+    // Done
+    return result;
+}
+
+/** !
+ * Filter an array into a new array under the shared lock of the source. 
+ * 
+ * Each chunk of grain elements is tested in parallel, and counts the elements
+ * it keeps. A prefix sum of the counts sizes the new array exactly, and gives
+ * each chunk the index its kept elements start at, so the chunks copy them 
+ * in parallel and in order
+ * 
+ * @param p_array    the source
+ * @param pp_result  return
+ * @param pfn_filter tests each element
+ * @param p_context  passed to pfn_filter
+ * @param grain      elements in each chunk
+ * @param sized      pass pointers to elements, instead of their values
+ * 
+ * @return 1 on success, 0 on error
+ */
+static int array_filter_locked ( array *const p_array, array **const pp_result, fn_array_filter *pfn_filter, void *const p_context, size_t grain, bool sized )
+{
+
+    // Initialized data
+    struct array_transform_s filter = 
+    {
+        .p_array    = p_array,
+        .pfn_filter = pfn_filter,
+        .p_context  = p_context,
+        .grain      = ( grain ) ? grain : ARRAY_PARALLEL_GRAIN,
+        .sized      = sized
+    };
+    size_t chunks = 0,
+           kept   = 0;
+    int    result = 0;
+
+    // Lock
+    array_lock_shared(p_array);
+
+    // Allocate a flag for each element, and a count for each chunk
+    chunks           = ( p_array->count + filter.grain - 1 ) / filter.grain,
+    filter.p_keep    = ARRAY_REALLOC(0, p_array->count + 1),
+    filter.p_offsets = ARRAY_REALLOC(0, ( chunks + 1 ) * sizeof(size_t));
+
+    // Error check
+    if ( filter.p_keep == (void *) 0 || filter.p_offsets == (void *) 0 ) goto done;
+
+    // Test each element, in parallel
+    (void) array_parallel_for(chunks, 1, array_filter_test_range, &filter);
+
+    // Replace each count with the index the chunk starts at
+    for (size_t c = 0; c < chunks; c++)
+    {
+
+        // Initialized data
+        size_t chunk_kept = filter.p_offsets[c];
+
+        // Store the index
+        filter.p_offsets[c]  = kept,
+        kept                += chunk_kept;
+    }
+
+    // Construct the result with room for exactly the kept elements
+    if ( array_construct_sized_sync(&filter.p_result, ( kept ) ? kept : 1, p_array->element_size, p_array->sync) == 0 ) goto done;
+
+    // Copy the kept elements, in parallel
+    (void) array_parallel_for(chunks, 1, array_filter_copy_range, &filter);
+
+    // Return the result
+    filter.p_result->count = kept,
+    *pp_result             = filter.p_result,
+    result                 = 1;
+
+    done:
+
+    // Unlock
+    array_unlock_shared(p_array);
+
+    // Free the flags and counts
+    if ( filter.p_keep    ) filter.p_keep    = ARRAY_REALLOC(filter.p_keep, 0);
+    if ( filter.p_offsets ) filter.p_offsets = ARRAY_REALLOC(filter.p_offsets, 0);
+
+    // Done
+    return result;
+}
+
+/** !
+ * Reduce an array under its shared lock. 
+ * 
+ * Each chunk of grain elements folds into its own accumulator in parallel, 
+ * starting from the identity. The accumulators are then combined in chunk 
+ * order on the calling thread, so the result does not depend on the quantity
+ * of threads
+ * 
+ * @param p_array     the source
+ * @param p_result    holds the identity, and returns the result
+ * @param result_size bytes in the result
+ * @param pfn_reduce  folds an element into an accumulator
+ * @param pfn_combine folds an accumulator into another
+ * @param p_context   passed to pfn_reduce and pfn_combine
+ * @param grain       elements in each chunk
+ * @param sized       pass pointers to elements, instead of their values
+ * 
+ * @return 1 on success, 0 on error
+ */
+static int array_reduce_locked ( array *const p_array, void *const p_result, size_t result_size, fn_array_reduce *pfn_reduce, fn_array_combine *pfn_combine, void *const p_context, size_t grain, bool sized )
+{
+
+    // Initialized data
+    struct array_transform_s reduce = 
+    {
+        .p_array     = p_array,
+        .pfn_reduce  = pfn_reduce,
+        .p_context   = p_context,
+        .grain       = ( grain ) ? grain : ARRAY_PARALLEL_GRAIN,
+        .result_size = result_size,
+        .p_identity  = p_result,
+        .sized       = sized
+    };
+    size_t chunks = 0;
+    int    result = 1;
+
+    // Lock
+    array_lock_shared(p_array);
+
+    // Fast exit. The identity is the result of an empty array
+    if ( p_array->count == 0 ) goto done;
+
+    // Allocate an accumulator for each chunk
+    chunks                = ( p_array->count + reduce.grain - 1 ) / reduce.grain,
+    reduce.p_accumulators = ARRAY_REALLOC(0, chunks * result_size),
+    result                = reduce.p_accumulators != (void *) 0;
+
+    // Error check
+    if ( result == 0 ) goto done;
+
+    // Fold each chunk, in parallel
+    result = array_parallel_for(chunks, 1, array_reduce_range, &reduce);
+
+    // Combine the accumulators in order
+    for (size_t c = 1; result && c < chunks; c++)
+        result = pfn_combine(reduce.p_accumulators, reduce.p_accumulators + c * result_size, p_context) != 0;
+
+    // Return the result
+    if ( result ) memcpy(p_result, reduce.p_accumulators, result_size);
+
+    done:
+
+    // Unlock
+    array_unlock_shared(p_array);
+
+    // Free the accumulators
+    if ( reduce.p_accumulators ) reduce.p_accumulators = ARRAY_REALLOC(reduce.p_accumulators, 0);
+
+    // Done
+    return result;
+}
+
+/** !
+ * Get the shape of the elements that leave a pipeline, set by its last map,
+ * else by its source
+ * 
+ * @param p_pipeline     the pipeline
+ * @param p_element_size return
+ * 
+ * @return true if the elements are pointers to elements, else false if they are values
+ */
+static bool array_pipeline_output ( const array_pipeline *const p_pipeline, size_t *const p_element_size )
+{
+
+    // The last map decides
+    for (size_t i = p_pipeline->count; i-- > 0; )
+    {
+
+        // Skip other stages
+        if ( p_pipeline->p_stages[i].kind != ARRAY_PIPELINE_MAP ) continue;
+
+        // Return the size of its results
+        *p_element_size = p_pipeline->p_stages[i].element_size;
+
+        // Success
+        return p_pipeline->p_stages[i].sized;
+    }
+
+    // Else the source
+    *p_element_size = p_pipeline->p_array->element_size;
+
+    // Success
+    return p_pipeline->sized;
+}
+
+/** !
+ * Add a stage to a pipeline
+ * 
+ * @param p_pipeline the pipeline
+ * @param p_stage    the stage
+ * 
+ * @return 1 on success, 0 on error
+ */
+static int array_pipeline_push ( array_pipeline *const p_pipeline, const struct array_pipeline_stage_s *const p_stage )
+{
+
+    // Grow the stages
+    if ( p_pipeline->count == p_pipeline->max )
+    {
+
+        // Initialized data
+        size_t                         max      = ( p_pipeline->max ) ? p_pipeline->max * 2 : 4;
+        struct array_pipeline_stage_s *p_stages = ARRAY_REALLOC(p_pipeline->p_stages, max * sizeof(struct array_pipeline_stage_s));
+
+        // Error check
+        if ( p_stages == (void *) 0 ) return 0;
+
+        // Store the stages
+        p_pipeline->p_stages = p_stages,
+        p_pipeline->max      = max;
+    }
+
+    // Store the stage
+    p_pipeline->p_stages[p_pipeline->count++] = *p_stage;
+
+    // Success
+    return 1;
+}
+
+/** !
+ * Run one element of the source through every stage of a pipeline, and on to
+ * the terminal if it passes them all
+ * 
+ * @param p_pipeline the pipeline
+ * @param value      the element, as the source passes it
+ * @param index      the index of the element in the source
+ * @param pfn_sink   receives the element
+ * @param p_terminal passed to pfn_sink
+ * @param p_stop     set when a take has passed its last element
+ * 
+ * @return 1 on success, 0 on error
+ */
+static int array_pipeline_element ( array_pipeline *const p_pipeline, const void *value, size_t index, array_pipeline_sink *pfn_sink, struct array_pipeline_terminal_s *const p_terminal, bool *const p_stop )
+{
+
+    // Each stage
+    for (size_t i = 0; i < p_pipeline->count; i++)
+    {
+
+        // Initialized data
+        struct array_pipeline_stage_s *p_stage = &p_pipeline->p_stages[i];
+
+        // Strategy
+        switch ( p_stage->kind )
+        {
+
+            // Drop the element if it fails the test
+            case ARRAY_PIPELINE_FILTER:
+                if ( p_stage->pfn_filter(value, index, p_stage->p_context) == 0 ) return 1;
+                break;
+
+            // Replace the element with the result
+            case ARRAY_PIPELINE_MAP:
+                if ( p_stage->pfn_map(value, index, p_stage->p_result, p_stage->p_context) == 0 ) return 0;
+                value = ( p_stage->sized ) ? (const void *) p_stage->p_result : *(void **) p_stage->p_result;
+                break;
+
+            // End the pipeline after the last element
+            case ARRAY_PIPELINE_TAKE:
+                if ( ++p_stage->taken == p_stage->limit ) *p_stop = true;
+                break;
+        }
+    }
+
+    // Success
+    return pfn_sink(value, index, p_terminal);
+}
+
+/** !
+ * Run a pipeline under the shared lock of its source, in one pass. Scanning
+ * stops after a take passes its last element, or once the terminal has 
+ * received limit elements
+ * 
+ * @param p_pipeline the pipeline
+ * @param pfn_sink   receives each element that leaves the pipeline
+ * @param p_terminal passed to pfn_sink
+ * @param limit      elements the terminal needs, or SIZE_MAX for every element
+ * 
+ * @return 1 on success, 0 on error
+ */
+static int array_pipeline_run ( array_pipeline *const p_pipeline, array_pipeline_sink *pfn_sink, struct array_pipeline_terminal_s *const p_terminal, size_t limit )
+{
+
+    // Initialized data
+    array *p_array = p_pipeline->p_array;
+    bool   stop    = false;
+    int    result  = 1;
+
+    // Restart each take. A take of nothing ends the pipeline before it starts
+    for (size_t i = 0; i < p_pipeline->count; i++)
+        if ( p_pipeline->p_stages[i].kind == ARRAY_PIPELINE_TAKE )
+            p_pipeline->p_stages[i].taken = 0,
+            stop                          = stop || p_pipeline->p_stages[i].limit == 0;
+
+    // Fast exit
+    if ( stop ) return 1;
+
+    // Lock
+    array_lock_shared(p_array);
+
+    // Run each element through the stages, until the pipeline ends
+    for (size_t i = 0; result && stop == false && p_terminal->count < limit && i < p_array->count; i++)
+        result = array_pipeline_element(p_pipeline, ( p_pipeline->sized ) ? array_element(p_array, i) : p_array->p_p_elements[i], i, pfn_sink, p_terminal, &stop);
+
+    // Unlock
+    array_unlock_shared(p_array);
+
+    // Done
+    return result;
+}
+
+/** !
+ * Store an element that leaves a pipeline
+ * 
+ * @param p_terminal the terminal
+ * @param p_slot     where to store the element
+ * @param value      the element
+ * 
+ * @return void
+ */
+static inline void array_pipeline_store ( const struct array_pipeline_terminal_s *const p_terminal, void *const p_slot, const void *const value )
+{
+
+    // Copy the element ...
+    if ( p_terminal->sized ) memcpy(p_slot, value, p_terminal->element_size);
+
+    // ... or the value
+    else *(const void **) p_slot = value;
+
+    // Done
+    return;
+}
+
+/** !
+ * Append an element that leaves a pipeline to the collected array. Nothing
+ * else can see the array yet, so it is not locked
+ * 
+ * @param value      the element
+ * @param index      the index of the element in the source
+ * @param p_terminal the terminal
+ * 
+ * @return 1 on success, 0 on error
+ */
+static int array_pipeline_collect_sink ( const void *const value, size_t index, struct array_pipeline_terminal_s *const p_terminal )
+{
+
+    // Unused
+    (void) index;
+
+    // Grow the array
+    if ( array_storage_reserve(p_terminal->p_result, p_terminal->count + 1) == 0 ) return 0;
+
+    // Append the element
+    array_pipeline_store(p_terminal, array_element(p_terminal->p_result, p_terminal->count), value);
+    p_terminal->p_result->count = ++p_terminal->count;
+
+    // Success
+    return 1;
+}
+
+/** !
+ * Count an element that leaves a pipeline
+ * 
+ * @param value      the element
+ * @param index      the index of the element in the source
+ * @param p_terminal the terminal
+ * 
+ * @return 1
+ */
+static int array_pipeline_count_sink ( const void *const value, size_t index, struct array_pipeline_terminal_s *const p_terminal )
+{
+
+    // Unused
+    (void) value;
+    (void) index;
+
+    // Count the element
+    p_terminal->count++;
+
+    // Success
+    return 1;
+}
+
+/** !
+ * Store the first element that leaves a pipeline
+ * 
+ * @param value      the element
+ * @param index      the index of the element in the source
+ * @param p_terminal the terminal
+ * 
+ * @return 1
+ */
+static int array_pipeline_first_sink ( const void *const value, size_t index, struct array_pipeline_terminal_s *const p_terminal )
+{
+
+    // Unused
+    (void) index;
+
+    // Store the element
+    array_pipeline_store(p_terminal, p_terminal->p_value, value);
+    p_terminal->count++;
+
+    // Success
+    return 1;
+}
+
+/** !
+ * Call a function on an element that leaves a pipeline
+ * 
+ * @param value      the element
+ * @param index      the index of the element in the source
+ * @param p_terminal the terminal
+ * 
+ * @return the result of the function
+ */
+static int array_pipeline_foreach_sink ( const void *const value, size_t index, struct array_pipeline_terminal_s *const p_terminal )
+{
+
+    // Count the element
+    p_terminal->count++;
+
+    // Call the function
+    return p_terminal->pfn_foreach(value, index, p_terminal->p_context);
+}
+
+/** !
+ * Fold an element that leaves a pipeline into the accumulator
+ * 
+ * @param value      the element
+ * @param index      the index of the element in the source
+ * @param p_terminal the terminal
+ * 
+ * @return the result of the fold
+ */
+static int array_pipeline_reduce_sink ( const void *const value, size_t index, struct array_pipeline_terminal_s *const p_terminal )
+{
+
+    // Count the element
+    p_terminal->count++;
+
+    // Fold the element
+    return p_terminal->pfn_reduce(p_terminal->p_value, value, index, p_terminal->p_context);
+}
+
+/** !
+ * Construct a pipeline over an array
+ * 
+ * @param pp_pipeline return
+ * @param p_array     the source
+ * @param sized       pass pointers to elements, instead of their values
+ * 
+ * @return 1 on success, 0 on error
+ */
+static int array_pipeline_create ( array_pipeline **const pp_pipeline, array *const p_array, bool sized )
+{
+
+    // Argument check
+    if ( pp_pipeline == (void *) 0 ) goto no_pipeline;
+    if ( p_array     == (void *) 0 ) goto no_array;
+    if ( sized == false && p_array->element_size != sizeof(void *) ) goto not_pointer_array;
+
+    // Initialized data
+    array_pipeline *p_pipeline = ARRAY_REALLOC(0, sizeof(array_pipeline));
+
+    // Error check
+    if ( p_pipeline == (void *) 0 ) goto no_mem;
+
+    // Zero set
+    memset(p_pipeline, 0, sizeof(array_pipeline));
+
+    // Store the source
+    p_pipeline->p_array = p_array,
+    p_pipeline->sized   = sized;
+
+    // Return a pointer to the caller
+    *pp_pipeline = p_pipeline;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_pipeline:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for parameter \"pp_pipeline\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_array:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for parameter \"p_array\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            not_pointer_array:
+                #ifndef NDEBUG
+                    log_error("[array] Parameter \"p_array\" must be an array of pointers in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+/** !
+ * Add a map to a pipeline
+ * 
+ * @param p_pipeline   the pipeline
+ * @param element_size bytes in each result
+ * @param pfn_map      computes each element
+ * @param p_context    passed to pfn_map
+ * @param sized        pass pointers to the results, instead of the values they hold
+ * 
+ * @return 1 on success, 0 on error
+ */
+static int array_pipeline_add_map ( array_pipeline *const p_pipeline, size_t element_size, fn_array_map *pfn_map, void *const p_context, bool sized )
+{
+
+    // Argument check
+    if ( p_pipeline   == (void *) 0 ) goto no_pipeline;
+    if ( pfn_map      == (void *) 0 ) goto no_function;
+    if ( element_size == 0          ) goto zero_element_size;
+
+    // Initialized data
+    struct array_pipeline_stage_s stage = 
+    {
+        .kind         = ARRAY_PIPELINE_MAP,
+        .pfn_map      = pfn_map,
+        .p_context    = p_context,
+        .element_size = element_size,
+        .p_result     = ARRAY_REALLOC(0, element_size),
+        .sized        = sized
+    };
+
+    // Error check
+    if ( stage.p_result == (void *) 0 ) goto no_mem;
+
+    // Add the stage
+    if ( array_pipeline_push(p_pipeline, &stage) == 0 ) goto failed_to_add_stage;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_pipeline:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for parameter \"p_pipeline\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_function:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for parameter \"pfn_map\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            zero_element_size:
+                #ifndef NDEBUG
+                    log_error("[array] Zero provided for parameter \"element_size\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Array errors
+        {
+            failed_to_add_stage:
+                #ifndef NDEBUG
+                    log_error("[array] Failed to add stage in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Free the result
+                stage.p_result = ARRAY_REALLOC(stage.p_result, 0);
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+void array_init ( void ) 
+{
+
+    // State check
+    if ( initialized == true ) return;
+
+    // Initialize the sync library
+    sync_init();
+    
+    // Initialize the log library
+    log_init();
+
+    // Set the initialized flag
+    initialized = true;
+
+    // Done
+    return; 
+}
+
+int array_create ( array **const pp_array )
+{
+
+    // Allocate an array with the default inline storage
+    return array_allocate(pp_array, ARRAY_INLINE_BYTES, (void *) 0);
+}
+
+int array_create_allocator ( array **const pp_array, const array_allocator *const p_allocator )
+{
+
+    // Allocate an array with the default inline storage
+    return array_allocate(pp_array, ARRAY_INLINE_BYTES, p_allocator);
+}
+
+int array_construct ( array **const pp_array, size_t size )
+{
+
+    // Construct an array with a mutex
+    return array_construct_sync(pp_array, size, ARRAY_SYNC_MUTEX);
+}
+
+int array_construct_sync ( array **const pp_array, size_t size, array_sync sync )
+{
+
+    // Construct an array of pointers
+    return array_construct_sized_sync(pp_array, size, sizeof(void *), sync);
+}
+
+int array_construct_sized ( array **const pp_array, size_t size, size_t element_size )
+{
+
+    // Construct a sized array with a mutex
+    return array_construct_sized_sync(pp_array, size, element_size, ARRAY_SYNC_MUTEX);
+}
+
+int array_construct_sized_sync ( array **const pp_array, size_t size, size_t element_size, array_sync sync )
+{
+
+    // Construct a sized array with the default inline storage
+    return array_construct_storage(pp_array, size, element_size, sync, ARRAY_INLINE_BYTES, (void *) 0);
+}
+
+int array_construct_inline ( array **const pp_array, size_t size, size_t element_size, array_sync sync )
+{
+
+    // Construct a sized array with room for every element inline
+    return array_construct_storage(pp_array, size, element_size, sync, array_storage_bytes(element_size, size), (void *) 0);
+}
+
+int array_construct_allocator ( array **const pp_array, size_t size, size_t element_size, array_sync sync, const array_allocator *const p_allocator )
+{
+
+    // Construct a sized array with the caller's allocator
+    return array_construct_storage(pp_array, size, element_size, sync, ARRAY_INLINE_BYTES, p_allocator);
+}
+
+int array_construct_sorted ( array **const pp_array, size_t size, array_sync sync, fn_array_compare *pfn_compare, void *const p_context )
+{
+
+    // Construct a sorted array of pointers
+    if ( array_construct_sized_sorted(pp_array, size, sizeof(void *), sync, pfn_compare, p_context) == 0 ) return 0;
+
+    // Compare the pointers, instead of pointers to them
+    (*pp_array)->by_value = true;
+
+    // Success
+    return 1;
+}
+
+int array_construct_sized_sorted ( array **const pp_array, size_t size, size_t element_size, array_sync sync, fn_array_compare *pfn_compare, void *const p_context )
+{
+
+    // Argument check
+    if ( pfn_compare == (void *) 0 ) goto no_function;
+
+    // Construct a sized array
+    if ( array_construct_sized_sync(pp_array, size, element_size, sync) == 0 ) goto failed_to_construct_array;
+
+    // Store the comparator
+    (*pp_array)->pfn_compare = pfn_compare,
+    (*pp_array)->p_compare   = p_context;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_function:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for parameter \"pfn_compare\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Array errors
+        {
+            failed_to_construct_array:
+                #ifndef NDEBUG
+                    log_error("[array] Failed to construct array in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int array_from_elements ( array **pp_array, void *_p_elements[] )
+{
+
+    // Argument check
+    if ( pp_array == (void *) 0 ) goto no_array;
+    if ( _p_elements == (void *) 0 ) goto no_elements;
+
+    // Initialized data
+    array  *p_array       = 0;
+    size_t  element_count = 0;
+
+    // Count elements
+    while ( _p_elements[element_count] ) element_count++;
+
+    // Allocate an array
+    if ( array_construct(&p_array, ( element_count ) ? element_count : 1) == 0 ) goto failed_to_allocate_array;        
+
+    // Add the elements to the array
+    if ( array_add_many(p_array, _p_elements, element_count) == 0 ) goto failed_to_add_elements;
+
+    // Return
+    *pp_array = p_array;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_array:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for \"pp_array\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error 
+                return 0;
+
+            no_elements:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for \"_p_elements\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error 
+                return 0;
+        }
+
+        // Array errors
+        {
+            failed_to_allocate_array:
+                #ifndef NDEBUG
+                    log_error("[array] Call to \"array_construct\" returned an erroneous value in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            failed_to_add_elements:
+                #ifndef NDEBUG
+                    log_error("[array] Call to \"array_add_many\" returned an erroneous value in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Free the array
+                array_destroy(&p_array);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int array_from_arguments ( array **const pp_array, size_t size, size_t element_count, ... )
+{
+
+    // Argument check
+    if ( pp_array == (void *) 0 ) goto no_array;
+
+    // Uninitialized data
+    va_list list;
+
+    // Initialized data
+    array  *p_array      = 0;
+    void  **p_p_elements = 0;
+
+    // Allocate a buffer for the variadic elements
+    if ( element_count )
+    {
+
+        // Allocate memory for the elements
+        p_p_elements = ARRAY_REALLOC(0, element_count * sizeof(void *));
+
+        // Error check
+        if ( p_p_elements == (void *) 0 ) goto no_mem;
+    }
+
+    // Initialize the variadic list
+    va_start(list, element_count);
+
+    // Store each element
+    for (size_t i = 0; i < element_count; i++)
+        p_p_elements[i] = va_arg(list, void *);
+
+    // End the variadic list
+    va_end(list);
+
+    // Allocate an array
+    if ( array_construct(&p_array, size) == 0 ) goto failed_to_allocate_array;        
+
+    // Add the elements to the array
+    if ( array_add_many(p_array, p_p_elements, element_count) == 0 ) goto failed_to_add_elements;
+
+    // Free the buffer
+    p_p_elements = ARRAY_REALLOC(p_p_elements, 0);
+
+    // Return a pointer to the caller
+    *pp_array = p_array;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_array:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for \"pp_array\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error 
+                return 0;
+        }
+
+        // Array errors
+        {
+            failed_to_allocate_array:
+                #ifndef NDEBUG
+                    log_error("[array] Call to \"array_construct\" returned an erroneous value in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Free the buffer
+                p_p_elements = ARRAY_REALLOC(p_p_elements, 0);
+
+                // Error
+                return 0;
+
+            failed_to_add_elements:
+                #ifndef NDEBUG
+                    log_error("[array] Call to \"array_add_many\" returned an erroneous value in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Free the array
+                array_destroy(&p_array);
+
+                // Free the buffer
+                p_p_elements = ARRAY_REALLOC(p_p_elements, 0);
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int array_index ( array *const p_array, signed index, void **const pp_value )
+{
+
+    // Argument errors
+    if ( p_array        == (void *) 0 ) goto no_array;
+    if ( p_array->count ==          0 ) goto no_elements;
+    if ( pp_value       == (void *) 0 ) goto no_value;
+    if ( p_array->element_size != sizeof(void *) ) goto not_pointer_array;
+
+    // Initialized data
+    size_t _index = 0;
+
+    // Sequence lock
+    if ( p_array->sync == ARRAY_SYNC_SEQLOCK )
+    {
+
+        // Initialized data
+        size_t   sequence     = 0,
+                 count        = 0;
+        void   **p_p_elements = 0,
+                *p_value      = 0;
+        bool     in_bounds    = false;
+
+        // Read without locking, and retry if a writer raced
+        do
+        {
+
+            // Wait for the active writer, if any
+            while ( ( sequence = __atomic_load_n(&p_array->sequence, __ATOMIC_ACQUIRE) ) & 1 );
+
+            // Read the count and the storage
+            count        = __atomic_load_n(&p_array->count, __ATOMIC_RELAXED),
+            p_p_elements = __atomic_load_n(&p_array->p_p_elements, __ATOMIC_RELAXED);
+
+            // The count and the storage only agree if no writer raced ...
+            __atomic_thread_fence(__ATOMIC_ACQUIRE);
+            if ( __atomic_load_n(&p_array->sequence, __ATOMIC_RELAXED) != sequence ) continue;
+
+            // ... in which case the storage is live or retired, but never freed
+            in_bounds = array_index_resolve(count, index, &_index);
+            if ( in_bounds ) p_value = __atomic_load_n(&p_p_elements[_index], __ATOMIC_RELAXED);
+
+            // The element is only valid if no writer raced
+            __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        }
+        while ( __atomic_load_n(&p_array->sequence, __ATOMIC_RELAXED) != sequence );
+
+        // Error check
+        if ( in_bounds == false ) goto seqlock_bounds_error;
+
+        // Return the element
+        *pp_value = p_value;
+
+        // Success
+        return 1;
+    }
+
+    // Lock
+    array_lock_shared(p_array);
+
+    // Error check
+    if ( array_index_resolve(p_array->count, index, &_index) == false ) goto bounds_error;
+
+    // Return the element
+    *pp_value = p_array->p_p_elements[_index];
+
+    // Unlock
+    array_unlock_shared(p_array);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        no_array:
+            #ifndef NDEBUG
+                log_error("[array] Null pointer provided for parameter \"p_array\" in call to function \"%s\"\n", __FUNCTION__);
+            #endif
+
+            // Error
+            return 0;
+
+        not_pointer_array:
+            #ifndef NDEBUG
+                log_error("[array] Parameter \"p_array\" must be an array of pointers in call to function \"%s\"\n", __FUNCTION__);
+            #endif
+
+            // Error
+            return 0;
+
+        no_value:
+            #ifndef NDEBUG
+                log_error("[array] Null pointer provided for parameter \"p_value\" in call to function \"%s\"\n", __FUNCTION__);
+            #endif
+
+            // Error
+            return 0;
+
+        no_elements:
+            #ifndef NDEBUG
+                log_error("[array] Can not index an empty array in call to function \"%s\"\n", __FUNCTION__);
+            #endif
+
+            // Error 
+            return 0;
+        
+        bounds_error:
+            #ifndef NDEBUG
+                log_error("[array] Index out of bounds in call to function \"%s\"\n", __FUNCTION__);
+            #endif
+
+            // Unlock
+            array_unlock_shared(p_array);
+            
+            // Error
+            return 0;
+
+        seqlock_bounds_error:
+            #ifndef NDEBUG
+                log_error("[array] Index out of bounds in call to function \"%s\"\n", __FUNCTION__);
+            #endif
+
+            // Error
+            return 0;
+    }
+}
+
+int array_get ( array *const p_array, void **const pp_elements, size_t *const p_count )
+{
+
+    // Argument check
+    if ( p_array == (void *) 0 ) goto no_array;
+    if ( p_array->element_size != sizeof(void *) ) goto not_pointer_array;
+
+    // Lock
+    array_lock_shared(p_array);
+
+    // Return the elements
+    if ( pp_elements )
+        memcpy(pp_elements, p_array->p_p_elements, (sizeof(void *) * p_array->count) );
+    
+    // Return the count
+    if ( p_count )
+        *p_count = p_array->count;
+
+    // Unlock
+    array_unlock_shared(p_array);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_array:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for \"p_array\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error 
+                return 0;
+
+            not_pointer_array:
+                #ifndef NDEBUG
+                    log_error("[array] Parameter \"p_array\" must be an array of pointers in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int array_view_acquire ( array *const p_array, const void *const **const ppp_elements, size_t *const p_count )
+{
+
+    // Argument check
+    if ( p_array      == (void *) 0 ) goto no_array;
+    if ( ppp_elements == (void *) 0 ) goto no_elements;
+    if ( p_array->element_size != sizeof(void *) ) goto not_pointer_array;
+
+    // Lock. The lock is held until array_view_release
+    array_lock_shared(p_array);
+
+    // Return the elements
+    *ppp_elements = (const void *const *) p_array->p_p_elements;
+
+    // Return the count
+    if ( p_count )
+        *p_count = p_array->count;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_array:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for \"p_array\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error 
+                return 0;
+
+            not_pointer_array:
+                #ifndef NDEBUG
+                    log_error("[array] Parameter \"p_array\" must be an array of pointers in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_elements:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for \"ppp_elements\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error 
+                return 0;
+        }
+    }
+}
+
+int array_view_release ( array *const p_array )
+{
+
+    // Argument check
+    if ( p_array == (void *) 0 ) goto no_array;
+
+    // Unlock
+    array_unlock_shared(p_array);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_array:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for \"p_array\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error 
+                return 0;
+        }
+    }
+}
+
+int array_slice ( array *const p_array, void *pp_elements[], signed lower_bound, signed upper_bound )
+{
+
+    // Argument check
+    if ( p_array == (void *) 0 ) goto no_array;
+    if ( lower_bound < 0 ) goto erroneous_lower_bound;
+    if ( upper_bound < lower_bound ) goto erroneous_upper_bound;
+    if ( p_array->element_size != sizeof(void *) ) goto not_pointer_array;
+
+    // Lock
+    array_lock_shared(p_array);
+
+    // Bounds check
+    if ( p_array->count <= (size_t) upper_bound ) goto out_of_bounds;
+
+    // Return the elements
+    if ( pp_elements )
+        memcpy(pp_elements, &p_array->p_p_elements[lower_bound], sizeof(void *) * (size_t) ( upper_bound - lower_bound + 1LL ) );
+    
+    // Unlock
+    array_unlock_shared(p_array);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_array:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for \"p_array\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error 
+                return 0;
+
+            not_pointer_array:
+                #ifndef NDEBUG
+                    log_error("[array] Parameter \"p_array\" must be an array of pointers in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            erroneous_lower_bound:
+                #ifndef NDEBUG
+                    log_error("[array] Parameter \"lower_bound\" must be greater than zero in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error 
+                return 0;
+                
+            erroneous_upper_bound:
+                #ifndef NDEBUG
+                    log_error("[array] Parameter \"upper_bound\" must be greater than or equal to \"lower_bound\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error 
+                return 0;
+        }
+
+        // Array errors
+        {
+            out_of_bounds:
+                #ifndef NDEBUG
+                    log_error("[array] Parameter \"upper_bound\" must be less than array size in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Unlock
+                array_unlock_shared(p_array);
+
+                // Error 
+                return 0;
+        }
+    }
+}
+
+bool array_is_empty ( array *const p_array )
+{
+
+    // Argument check
+    if ( p_array == (void *) 0 ) goto no_array;
+
+    // Initialized data
+    bool ret = false;
+
+    // Sequence lock. Reading one word needs no retry
+    if ( p_array->sync == ARRAY_SYNC_SEQLOCK )
+        return ( 0 == __atomic_load_n(&p_array->count, __ATOMIC_RELAXED) );
+
+    // Lock
+    array_lock_shared(p_array);
+
+    // Is empty?
+    ret = ( 0 == p_array->count );
+
+    // Unlock
+    array_unlock_shared(p_array);
+
+    // Success
+    return ret;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_array:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for parameter \"p_array\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+size_t array_size ( array *const p_array )
+{
+
+    // Argument check
+    if ( p_array == (void *) 0 ) goto no_array;
+
+    // Success
+    return __atomic_load_n(&p_array->count, __ATOMIC_RELAXED);
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_array:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for parameter \"p_array\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+size_t array_capacity ( array *const p_array )
+{
+
+    // Argument check
+    if ( p_array == (void *) 0 ) goto no_array;
+
+    // Success
+    return __atomic_load_n(&p_array->max, __ATOMIC_RELAXED);
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_array:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for parameter \"p_array\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int array_add ( array *p_array, void *p_element )
+{
+
+    // Argument check
+    if ( p_array == (void *) 0 ) goto no_array;
+    if ( p_array->element_size != sizeof(void *) ) goto not_pointer_array;
+
+    // Lock
+    array_lock_exclusive(p_array);
+
+    // Resize iterable max?
+    if ( array_storage_reserve(p_array, p_array->count + 1) == 0 ) goto no_mem;
+
+    // Update the iterables. Sorted arrays insert at the lower bound
+    p_array->p_p_elements[( p_array->pfn_compare ) ? array_sorted_open(p_array, p_element) : p_array->count] = p_element;
+
+    // Increment the entry counter
+    p_array->count++;
+    
+    // Unlock
+    array_unlock_exclusive(p_array);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_array:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for \"p_array\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            not_pointer_array:
+                #ifndef NDEBUG
+                    log_error("[array] Parameter \"p_array\" must be an array of pointers in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Unlock
+                array_unlock_exclusive(p_array);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int array_add_many ( array *const p_array, void *const *const pp_elements, size_t count )
+{
+
+    // Argument check
+    if ( p_array     == (void *) 0 ) goto no_array;
+    if ( pp_elements == (void *) 0 && count ) goto no_elements;
+    if ( p_array->element_size != sizeof(void *) ) goto not_pointer_array;
+
+    // Fast exit
+    if ( count == 0 ) return 1;
+
+    // Lock
+    array_lock_exclusive(p_array);
+
+    // Grow once
+    if ( array_storage_reserve(p_array, p_array->count + count) == 0 ) goto no_mem;
+
+    // Sorted arrays insert each element at its lower bound
+    if ( p_array->pfn_compare )
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+
+            // Insert the element
+            p_array->p_p_elements[array_sorted_open(p_array, pp_elements[i])] = pp_elements[i];
+
+            // Increment the entry counter
+            p_array->count++;
+        }
+    }
+
+    // Other arrays copy the elements to the end
+    else
+    {
+
+        // Copy the elements
+        memcpy(&p_array->p_p_elements[p_array->count], pp_elements, count * sizeof(void *));
+
+        // Update the entry counter
+        p_array->count += count;
+    }
+
+    // Unlock
+    array_unlock_exclusive(p_array);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_array:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for \"p_array\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            not_pointer_array:
+                #ifndef NDEBUG
+                    log_error("[array] Parameter \"p_array\" must be an array of pointers in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_elements:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for \"pp_elements\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Unlock
+                array_unlock_exclusive(p_array);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int array_insert ( array *const p_array, signed index, void *const p_element )
+{
+
+    // Insert one element
+    return array_insert_many(p_array, index, &p_element, 1);
+}
+
+int array_insert_many ( array *const p_array, signed index, void *const *const pp_elements, size_t count )
+{
+
+    // Argument check
+    if ( p_array     == (void *) 0 ) goto no_array;
+    if ( pp_elements == (void *) 0 && count ) goto no_elements;
+    if ( p_array->element_size != sizeof(void *) ) goto not_pointer_array;
+
+    // State check
+    if ( p_array->pfn_compare ) goto sorted_array;
+
+    // Initialized data
+    size_t _index = 0;
+
+    // Lock
+    array_lock_exclusive(p_array);
+
+    // Error check. A positive index may be one past the last element
+    if ( array_index_resolve(( index >= 0 ) ? p_array->count + 1 : p_array->count, index, &_index) == false ) goto bounds_error;
+
+    // Fast exit
+    if ( count == 0 ) goto done;
+
+    // Grow once
+    if ( array_storage_reserve(p_array, p_array->count + count) == 0 ) goto no_mem;
+
+    // Shift the tail
+    memmove(&p_array->p_p_elements[_index + count], &p_array->p_p_elements[_index], ( p_array->count - _index ) * sizeof(void *));
+
+    // Copy the elements
+    memcpy(&p_array->p_p_elements[_index], pp_elements, count * sizeof(void *));
+
+    // Update the entry counter
+    p_array->count += count;
+
+    done:
+
+    // Unlock
+    array_unlock_exclusive(p_array);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_array:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for \"p_array\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            not_pointer_array:
+                #ifndef NDEBUG
+                    log_error("[array] Parameter \"p_array\" must be an array of pointers in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_elements:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for \"pp_elements\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Array errors
+        {
+            sorted_array:
+                #ifndef NDEBUG
+                    log_error("[array] Can not reorder a sorted array in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            bounds_error:
+                #ifndef NDEBUG
+                    log_error("[array] Index out of bounds in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Unlock
+                array_unlock_exclusive(p_array);
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Unlock
+                array_unlock_exclusive(p_array);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int array_set ( array *p_array, signed index, void *p_value )
+{
+    
+    // Argument check   
+    if ( p_array == (void *) 0 ) goto no_array;
+    if ( p_array->element_size != sizeof(void *) ) goto not_pointer_array;
+
+    // State check
+    if ( p_array->count       == 0          ) goto no_elements;
+    if ( p_array->pfn_compare != (void *) 0 ) goto sorted_array;
+    
+    // Initialized data
+    size_t _index = 0;
+
+    // Lock
+    array_lock_exclusive(p_array);
+
+    // Error check
+    if ( array_index_resolve(p_array->count, index, &_index) == false ) goto bounds_error;
+    
+    // Store the element
+    p_array->p_p_elements[_index] = p_value;
+
+    // Unlock
+    array_unlock_exclusive(p_array);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_array:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for \"p_array\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            not_pointer_array:
+                #ifndef NDEBUG
+                    log_error("[array] Parameter \"p_array\" must be an array of pointers in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Array errors
+        {
+            sorted_array:
+                #ifndef NDEBUG
+                    log_error("[array] Can not reorder a sorted array in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            bounds_error:
+                #ifndef NDEBUG
+                    log_error("[array] Index out of bounds in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Unlock
+                array_unlock_exclusive(p_array);
+
+                // Error
+                return 0;
+
+            no_elements:
+                #ifndef NDEBUG
+                    log_error("[array] Can not index an empty array in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error 
+                return 0;
+        
+        }
+    }
+}
+
+int array_remove ( array *const p_array, signed index, void **const pp_value )
+{
+
+    // Argument check
+    if ( p_array == (void *) 0 ) goto no_array;
+    if ( p_array->element_size != sizeof(void *) ) goto not_pointer_array;
+
+    // State check
+    if ( p_array->count == 0 ) goto no_elements;
+    
+    // Initialized data
+    size_t _index = 0;
+
+    // Lock
+    array_lock_exclusive(p_array);
+
+    // Error check
+    if ( array_index_resolve(p_array->count, index, &_index) == false ) goto bounds_error;
+    
+    // Store the element
+    if ( pp_value != (void *) 0 ) *pp_value = p_array->p_p_elements[_index];
+
+    // Shift the elements after the removed element
+    memmove(&p_array->p_p_elements[_index], &p_array->p_p_elements[_index + 1], ( p_array->count - _index - 1 ) * sizeof(void *));
+
+    // Decrement the element counter
+    p_array->count--;
+
+    // Give back unused storage
+    array_storage_trim(p_array);
+
+    // Unlock
+    array_unlock_exclusive(p_array);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_array:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for \"p_array\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            not_pointer_array:
+                #ifndef NDEBUG
+                    log_error("[array] Parameter \"p_array\" must be an array of pointers in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Array errors
+        {
+            bounds_error:
+                #ifndef NDEBUG
+                    log_error("[array] Index out of bounds in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Unlock
+                array_unlock_exclusive(p_array);
+
+                // Error
+                return 0;
+
+            no_elements:
+                #ifndef NDEBUG
+                    log_error("[array] Can not index an empty array in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error 
+                return 0;
+        
+        }
+    }
+}
+
+int array_remove_range ( array *const p_array, signed lower_bound, signed upper_bound, void **const pp_values )
+{
+
+    // Argument check
+    if ( p_array     == (void *) 0  ) goto no_array;
+    if ( lower_bound <  0           ) goto erroneous_lower_bound;
+    if ( upper_bound <  lower_bound ) goto erroneous_upper_bound;
+    if ( p_array->element_size != sizeof(void *) ) goto not_pointer_array;
+
+    // Initialized data
+    size_t lower = (size_t) lower_bound,
+           upper = (size_t) upper_bound;
+
+    // Lock
+    array_lock_exclusive(p_array);
+
+    // Bounds check
+    if ( p_array->count <= upper ) goto out_of_bounds;
+
+    // Return the removed elements
+    if ( pp_values )
+        memcpy(pp_values, &p_array->p_p_elements[lower], ( upper - lower + 1 ) * sizeof(void *));
+
+    // Close the gap
+    memmove(&p_array->p_p_elements[lower], &p_array->p_p_elements[upper + 1], ( p_array->count - upper - 1 ) * sizeof(void *));
+
+    // Update the element counter
+    p_array->count -= upper - lower + 1;
+
+    // Give back unused storage
+    array_storage_trim(p_array);
+
+    // Unlock
+    array_unlock_exclusive(p_array);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_array:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for \"p_array\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            not_pointer_array:
+                #ifndef NDEBUG
+                    log_error("[array] Parameter \"p_array\" must be an array of pointers in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            erroneous_lower_bound:
+                #ifndef NDEBUG
+                    log_error("[array] Parameter \"lower_bound\" must be greater than or equal to zero in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error 
+                return 0;
+                
+            erroneous_upper_bound:
+                #ifndef NDEBUG
+                    log_error("[array] Parameter \"upper_bound\" must be greater than or equal to \"lower_bound\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error 
+                return 0;
+        }
+
+        // Array errors
+        {
+            out_of_bounds:
+                #ifndef NDEBUG
+                    log_error("[array] Parameter \"upper_bound\" must be less than array size in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Unlock
+                array_unlock_exclusive(p_array);
+
+                // Error 
+                return 0;
+        }
+    }
+}
+
+int array_remove_unordered ( array *const p_array, signed index, void **const pp_value )
+{
+
+    // Argument check
+    if ( p_array == (void *) 0 ) goto no_array;
+    if ( p_array->element_size != sizeof(void *) ) goto not_pointer_array;
+
+    // State check
+    if ( p_array->pfn_compare ) goto sorted_array;
+
+    // Initialized data
+    size_t _index = 0;
+
+    // Lock
+    array_lock_exclusive(p_array);
+
+    // Error check
+    if ( array_index_resolve(p_array->count, index, &_index) == false ) goto bounds_error;
+    
+    // Store the element
+    if ( pp_value != (void *) 0 ) *pp_value = p_array->p_p_elements[_index];
+
+    // Fill the hole with the last element
+    p_array->p_p_elements[_index] = p_array->p_p_elements[p_array->count - 1];
+
+    // Decrement the element counter
+    p_array->count--;
+
+    // Give back unused storage
+    array_storage_trim(p_array);
+
+    // Unlock
+    array_unlock_exclusive(p_array);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_array:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for \"p_array\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            not_pointer_array:
+                #ifndef NDEBUG
+                    log_error("[array] Parameter \"p_array\" must be an array of pointers in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Array errors
+        {
+            sorted_array:
+                #ifndef NDEBUG
+                    log_error("[array] Can not reorder a sorted array in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            bounds_error:
+                #ifndef NDEBUG
+                    log_error("[array] Index out of bounds in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Unlock
+                array_unlock_exclusive(p_array);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int array_remove_unordered_many ( array *const p_array, const signed *const p_indices, size_t count, void **const pp_values )
+{
+
+    // Argument check
+    if ( p_array   == (void *) 0 ) goto no_array;
+    if ( p_indices == (void *) 0 && count ) goto no_indices;
+    if ( p_array->element_size != sizeof(void *) ) goto not_pointer_array;
+
+    // State check
+    if ( p_array->pfn_compare ) goto sorted_array;
+
+    // Fast exit
+    if ( count == 0 ) return 1;
+
+    // Initialized data
+    size_t *p_resolved = ARRAY_REALLOC(0, count * sizeof(size_t));
+
+    // Error check
+    if ( p_resolved == (void *) 0 ) goto no_mem;
+
+    // Lock
+    array_lock_exclusive(p_array);
+
+    // Resolve each index
+    for (size_t i = 0; i < count; i++)
+        if ( array_index_resolve(p_array->count, p_indices[i], &p_resolved[i]) == false ) goto bounds_error;
+
+    // Remove from the back to the front. Every element that fills a hole 
+    // comes from past the largest remaining index, so it is never removed
+    qsort(p_resolved, count, sizeof(size_t), array_index_compare_descending);
+
+    // Error check
+    for (size_t i = 1; i < count; i++)
+        if ( p_resolved[i] == p_resolved[i - 1] ) goto duplicate_index;
+
+    // Every index is valid. Return each element in the caller's order
+    if ( pp_values != (void *) 0 )
+        for (size_t i = 0, index = 0; i < count; i++)
+        {
+
+            // Resolve the index again, since the resolved indices are sorted
+            (void) array_index_resolve(p_array->count, p_indices[i], &index);
+
+            // Store the element
+            pp_values[i] = p_array->p_p_elements[index];
+        }
+
+    // Fill each hole with the last element
+    for (size_t i = 0; i < count; i++)
+    {
+        p_array->p_p_elements[p_resolved[i]] = p_array->p_p_elements[p_array->count - 1];
+        p_array->count--;
+    }
+
+    // Give back unused storage
+    array_storage_trim(p_array);
+
+    // Unlock
+    array_unlock_exclusive(p_array);
+
+    // Free the indices
+    p_resolved = ARRAY_REALLOC(p_resolved, 0);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_array:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for \"p_array\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            not_pointer_array:
+                #ifndef NDEBUG
+                    log_error("[array] Parameter \"p_array\" must be an array of pointers in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_indices:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for \"p_indices\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Array errors
+        {
+            sorted_array:
+                #ifndef NDEBUG
+                    log_error("[array] Can not reorder a sorted array in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            bounds_error:
+                #ifndef NDEBUG
+                    log_error("[array] Index out of bounds in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Unlock
+                array_unlock_exclusive(p_array);
+
+                // Free the indices
+                p_resolved = ARRAY_REALLOC(p_resolved, 0);
+
+                // Error
+                return 0;
+
+            duplicate_index:
+                #ifndef NDEBUG
+                    log_error("[array] Parameter \"p_indices\" refers to the same element more than once in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Unlock
+                array_unlock_exclusive(p_array);
+
+                // Free the indices
+                p_resolved = ARRAY_REALLOC(p_resolved, 0);
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int array_growth_set ( array *const p_array, array_growth growth, size_t increment, fn_array_growth *pfn_growth )
+{
+
+    // Argument check
+    if ( p_array == (void *) 0 ) goto no_array;
+    if ( growth > ( ARRAY_GROWTH_USABLE_SIZE | ARRAY_GROWTH_POLICY_MASK ) ) goto bad_growth;
+    if ( ( growth & ARRAY_GROWTH_POLICY_MASK ) > ARRAY_GROWTH_CALLBACK ) goto bad_growth;
+    if ( ( growth & ARRAY_GROWTH_POLICY_MASK ) == ARRAY_GROWTH_FIXED    && increment  == 0          ) goto no_increment;
+    if ( ( growth & ARRAY_GROWTH_POLICY_MASK ) == ARRAY_GROWTH_CALLBACK && pfn_growth == (void *) 0 ) goto no_growth_function;
+
+    // Lock
+    array_lock_exclusive(p_array);
+
+    // Store the policy
+    p_array->growth     = growth,
+    p_array->increment  = increment,
+    p_array->pfn_growth = pfn_growth;
+
+    // Unlock
+    array_unlock_exclusive(p_array);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_array:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for \"p_array\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            bad_growth:
+                #ifndef NDEBUG
+                    log_error("[array] Parameter \"growth\" must be a valid growth policy in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_increment:
+                #ifndef NDEBUG
+                    log_error("[array] Parameter \"increment\" must be greater than zero in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_growth_function:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for \"pfn_growth\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int array_shrink_policy_set ( array *const p_array, double threshold, size_t min_capacity )
+{
+
+    // Argument check
+    if ( p_array == (void *) 0                 ) goto no_array;
+    if ( threshold < 0 || threshold >= 0.5     ) goto bad_threshold;
+    if ( min_capacity == 0                     ) goto zero_size;
+
+    // Lock
+    array_lock_exclusive(p_array);
+
+    // Store the policy
+    p_array->shrink_below = threshold,
+    p_array->shrink_min   = min_capacity;
+
+    // Unlock
+    array_unlock_exclusive(p_array);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_array:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for \"p_array\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            bad_threshold:
+                #ifndef NDEBUG
+                    log_error("[array] Parameter \"threshold\" must be at least zero and less than one half in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            zero_size:
+                #ifndef NDEBUG
+                    log_error("[array] Parameter \"min_capacity\" must be greater than zero in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int array_reserve ( array *const p_array, size_t capacity )
+{
+
+    // Argument check
+    if ( p_array  == (void *) 0                       ) goto no_array;
+    if ( capacity >  SIZE_MAX / p_array->element_size ) goto capacity_too_large;
+
+    // Lock
+    array_lock_exclusive(p_array);
+
+    // Grow to exactly the requested capacity
+    if ( capacity > p_array->max )
+        if ( array_storage_resize(p_array, capacity) == 0 ) goto no_mem;
+
+    // Unlock
+    array_unlock_exclusive(p_array);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_array:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for \"p_array\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            capacity_too_large:
+                #ifndef NDEBUG
+                    log_error("[array] Parameter \"capacity\" is too large for the element size in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Unlock
+                array_unlock_exclusive(p_array);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int array_shrink_to_fit ( array *const p_array )
+{
+
+    // Argument check
+    if ( p_array == (void *) 0 ) goto no_array;
+
+    // Initialized data
+    size_t max = 0;
+
+    // Lock
+    array_lock_exclusive(p_array);
+
+    // An array always has room for at least one element
+    max = ( p_array->count ) ? p_array->count : 1;
+
+    // Shrink the storage
+    if ( max < p_array->max )
+        if ( array_storage_resize(p_array, max) == 0 ) goto no_mem;
+
+    // Unlock
+    array_unlock_exclusive(p_array);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_array:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for \"p_array\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Unlock
+                array_unlock_exclusive(p_array);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int array_clear ( array *const p_array )
+{
+
+    // Argument check
+    if ( p_array == (void *) 0 ) goto no_array;
+
+    // Lock
+    array_lock_exclusive(p_array);
+
+    // Clear the entries
+    memset(p_array->p_p_elements, 0, p_array->element_size * p_array->count);
+
+    // Clear the element counter
+    p_array->count = 0;
+
+    // Give back unused storage
+    array_storage_trim(p_array);
+
+    // Unlock
+    array_unlock_exclusive(p_array);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_array:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for \"p_array\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+        }
+    }
+}
+
+int array_free_clear ( array *const p_array, void (*const free_fun_ptr)(void *) )
+{
+
+    // Argument check
+    if ( p_array      == (void *) 0 ) goto no_array;
+    if ( free_fun_ptr == (void *) 0 ) goto no_free_func;
+    if ( p_array->element_size != sizeof(void *) ) goto not_pointer_array;
+
+    // Lock
+    array_lock_exclusive(p_array);
+
+    // Iterate over each element in the array
+    for (size_t i = 0; i < p_array->count; i++)
+    {
+        
+        // Call the free function
+        free_fun_ptr(p_array->p_p_elements[i]);
+
+        // Clear the reference from the array
+        p_array->p_p_elements[i] = 0;
+    }
+
+    // Clear the element counter
+    p_array->count = 0;
+
+    // Give back unused storage
+    array_storage_trim(p_array);
+
+    // Unlock
+    array_unlock_exclusive(p_array);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_array:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for \"p_array\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            not_pointer_array:
+                #ifndef NDEBUG
+                    log_error("[array] Parameter \"p_array\" must be an array of pointers in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+            
+            no_free_func:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for \"free_fun_ptr\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+ 
+int array_foreach_i ( array *const p_array, fn_array_foreach_i *pfn_array_foreach_i ) 
+{
+
+    // Argument check
+    if ( p_array             == (void *) 0 ) goto no_array;
+    if ( pfn_array_foreach_i == (void *) 0 ) goto no_free_func;
+    if ( p_array->element_size != sizeof(void *) ) goto not_pointer_array;
+
+    // Lock
+    array_lock_shared(p_array);
+
+    // Iterate over each element in the array
+    for (size_t i = 0; i < p_array->count; i++)
+        
+        // Call the function
+        pfn_array_foreach_i(p_array->p_p_elements[i], i);
+
+    // Unlock
+    array_unlock_shared(p_array);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_array:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for \"p_array\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            not_pointer_array:
+                #ifndef NDEBUG
+                    log_error("[array] Parameter \"p_array\" must be an array of pointers in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+            
+            no_free_func:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for \"function\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int array_foreach_parallel ( array *const p_array, fn_array_foreach_parallel *pfn_foreach, void *const p_context, size_t grain )
+{
+
+    // Argument check
+    if ( p_array     == (void *) 0 ) goto no_array;
+    if ( pfn_foreach == (void *) 0 ) goto no_function;
+    if ( p_array->element_size != sizeof(void *) ) goto not_pointer_array;
+
+    // Initialized data
+    struct array_foreach_job_s foreach = 
+    {
+        .p_array     = p_array,
+        .pfn_foreach = pfn_foreach,
+        .p_context   = p_context,
+        .sized       = false
+    };
+    int result = 0;
+
+    // Lock
+    array_lock_shared(p_array);
+
+    // Call the function on each element in the array, in parallel
+    result = array_parallel_for(p_array->count, grain, array_foreach_parallel_range, &foreach);
+
+    // Unlock
+    array_unlock_shared(p_array);
+
+    // Done
+    return result;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_array:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for \"p_array\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            not_pointer_array:
+                #ifndef NDEBUG
+                    log_error("[array] Parameter \"p_array\" must be an array of pointers in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_function:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for \"pfn_foreach\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int array_map ( array *const p_array, array **const pp_result, fn_array_map *pfn_map, void *const p_context, size_t grain )
+{
+
+    // Argument check
+    if ( p_array   == (void *) 0 ) goto no_array;
+    if ( pp_result == (void *) 0 ) goto no_result;
+    if ( pfn_map   == (void *) 0 ) goto no_function;
+    if ( p_array->element_size != sizeof(void *) ) goto not_pointer_array;
+
+    // Map each value into a new array of pointers
+    return array_map_locked(p_array, pp_result, sizeof(void *), pfn_map, p_context, grain, false);
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_array:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for \"p_array\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            not_pointer_array:
+                #ifndef NDEBUG
+                    log_error("[array] Parameter \"p_array\" must be an array of pointers in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_result:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for \"pp_result\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_function:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for \"pfn_map\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int array_filter ( array *const p_array, array **const pp_result, fn_array_filter *pfn_filter, void *const p_context, size_t grain )
+{
+
+    // Argument check
+    if ( p_array    == (void *) 0 ) goto no_array;
+    if ( pp_result  == (void *) 0 ) goto no_result;
+    if ( pfn_filter == (void *) 0 ) goto no_function;
+    if ( p_array->element_size != sizeof(void *) ) goto not_pointer_array;
+
+    // Copy the values that pass the test into a new array
+    return array_filter_locked(p_array, pp_result, pfn_filter, p_context, grain, false);
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_array:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for \"p_array\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            not_pointer_array:
+                #ifndef NDEBUG
+                    log_error("[array] Parameter \"p_array\" must be an array of pointers in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_result:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for \"pp_result\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_function:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for \"pfn_filter\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int array_reduce ( array *const p_array, void *const p_result, size_t result_size, fn_array_reduce *pfn_reduce, fn_array_combine *pfn_combine, void *const p_context, size_t grain )
+{
+
+    // Argument check
+    if ( p_array     == (void *) 0 ) goto no_array;
+    if ( p_result    == (void *) 0 ) goto no_result;
+    if ( pfn_reduce  == (void *) 0 ) goto no_function;
+    if ( pfn_combine == (void *) 0 ) goto no_combine;
+    if ( result_size == 0          ) goto zero_size;
+    if ( p_array->element_size != sizeof(void *) ) goto not_pointer_array;
+
+    // Fold each value into the result
+    return array_reduce_locked(p_array, p_result, result_size, pfn_reduce, pfn_combine, p_context, grain, false);
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_array:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for \"p_array\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            not_pointer_array:
+                #ifndef NDEBUG
+                    log_error("[array] Parameter \"p_array\" must be an array of pointers in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_result:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for \"p_result\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_function:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for \"pfn_reduce\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_combine:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for \"pfn_combine\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            zero_size:
+                #ifndef NDEBUG
+                    log_error("[array] Zero provided for parameter \"result_size\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int array_sort ( array *const p_array, fn_array_compare *pfn_compare, void *const p_context )
+{
+
+    // Argument check
+    if ( p_array     == (void *) 0 ) goto no_array;
+    if ( pfn_compare == (void *) 0 ) goto no_function;
+    if ( p_array->element_size != sizeof(void *) ) goto not_pointer_array;
+
+    // State check
+    if ( p_array->pfn_compare ) goto sorted_array;
+
+    // Sort the values
+    return array_sort_locked(p_array, pfn_compare, p_context, true, false);
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_array:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for \"p_array\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            not_pointer_array:
+                #ifndef NDEBUG
+                    log_error("[array] Parameter \"p_array\" must be an array of pointers in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_function:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for \"pfn_compare\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Array errors
+        {
+            sorted_array:
+                #ifndef NDEBUG
+                    log_error("[array] Can not reorder a sorted array in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int array_sort_stable ( array *const p_array, fn_array_compare *pfn_compare, void *const p_context )
+{
+
+    // Argument check
+    if ( p_array     == (void *) 0 ) goto no_array;
+    if ( pfn_compare == (void *) 0 ) goto no_function;
+    if ( p_array->element_size != sizeof(void *) ) goto not_pointer_array;
+
+    // State check
+    if ( p_array->pfn_compare ) goto sorted_array;
+
+    // Sort the values, keeping equal values in order
+    return array_sort_locked(p_array, pfn_compare, p_context, true, true);
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_array:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for \"p_array\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            not_pointer_array:
+                #ifndef NDEBUG
+                    log_error("[array] Parameter \"p_array\" must be an array of pointers in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_function:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for \"pfn_compare\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Array errors
+        {
+            sorted_array:
+                #ifndef NDEBUG
+                    log_error("[array] Can not reorder a sorted array in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int array_lower_bound ( array *const p_array, const void *const p_key, size_t *const p_index )
+{
+
+    // Argument check
+    if ( p_array == (void *) 0 ) goto no_array;
+    if ( p_index == (void *) 0 ) goto no_index;
+
+    // State check
+    if ( p_array->pfn_compare == (void *) 0 ) goto not_sorted;
+
+    // Lock
+    array_lock_shared(p_array);
+
+    // Search
+    *p_index = array_sorted_search(p_array, p_key);
+
+    // Unlock
+    array_unlock_shared(p_array);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_array:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for \"p_array\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_index:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for \"p_index\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Array errors
+        {
+            not_sorted:
+                #ifndef NDEBUG
+                    log_error("[array] Array is not sorted in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int array_find_sorted ( array *const p_array, const void *const p_key, size_t *const p_index )
+{
+
+    // Argument check
+    if ( p_array == (void *) 0 ) goto no_array;
+
+    // State check
+    if ( p_array->pfn_compare == (void *) 0 ) goto not_sorted;
+
+    // Initialized data
+    size_t index = 0;
+    bool   found = false;
+
+    // Lock
+    array_lock_shared(p_array);
+
+    // Search, and test if the lower bound equals the key
+    index = array_sorted_search(p_array, p_key),
+    found = index < p_array->count && array_sorted_compare(p_array, array_element(p_array, index), p_key) == 0;
+
+    // Unlock
+    array_unlock_shared(p_array);
+
+    // Return the index to the caller
+    if ( found && p_index ) *p_index = index;
+
+    // Success
+    return found;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_array:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for \"p_array\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Array errors
+        {
+            not_sorted:
+                #ifndef NDEBUG
+                    log_error("[array] Array is not sorted in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int array_freeze ( array *const p_array )
+{
+
+    // Argument check
+    if ( p_array == (void *) 0 ) goto no_array;
+
+    // State check
+    if ( p_array->pfn_compare == (void *) 0 ) goto not_sorted;
+
+    // Initialized data
+    unsigned char *p_frozen = 0;
+
+    // Lock
+    array_lock_exclusive(p_array);
+
+    // Allocate room for the elements, aligned to a cache line. Slot 0 is unused
+    p_frozen = array_allocator_realloc(&p_array->allocator, p_array->p_frozen, ARRAY_CACHE_LINE - 1 + ( p_array->count + 1 ) * p_array->element_size);
+
+    // Error check
+    if ( p_frozen == (void *) 0 ) goto no_mem;
+
+    // Lay out the elements
+    p_array->p_frozen = p_frozen,
+    p_array->p_keys   = (unsigned char *) ( ( (uintptr_t) p_frozen + ARRAY_CACHE_LINE - 1 ) & ~(uintptr_t) ( ARRAY_CACHE_LINE - 1 ) );
+    (void) array_frozen_fill(p_array, 1, 0);
+
+    // The layout is fresh until the next write
+    p_array->frozen_count = p_array->count,
+    p_array->frozen_at    = p_array->modifications;
+
+    // Unlock
+    array_unlock_exclusive(p_array);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_array:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for \"p_array\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Array errors
+        {
+            not_sorted:
+                #ifndef NDEBUG
+                    log_error("[array] Array is not sorted in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Unlock
+                array_unlock_exclusive(p_array);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int array_thaw ( array *const p_array )
+{
+
+    // Argument check
+    if ( p_array == (void *) 0 ) goto no_array;
+
+    // Lock
+    array_lock_exclusive(p_array);
+
+    // Free the frozen layout
+    if ( p_array->p_frozen )
+        p_array->p_frozen = array_allocator_realloc(&p_array->allocator, p_array->p_frozen, 0);
+
+    // Unlock
+    array_unlock_exclusive(p_array);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_array:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for \"p_array\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int array_sized_add ( array *const p_array, const void *const p_element )
+{
+
+    // Argument check
+    if ( p_array   == (void *) 0 ) goto no_array;
+    if ( p_element == (void *) 0 ) goto no_element;
+
+    // Lock
+    array_lock_exclusive(p_array);
+
+    // Grow the storage, if there is no room for another element
+    if ( array_storage_reserve(p_array, p_array->count + 1) == 0 ) goto no_mem;
+
+    // Copy the element. Sorted arrays insert at the lower bound
+    memcpy(array_element(p_array, ( p_array->pfn_compare ) ? array_sorted_open(p_array, p_element) : p_array->count), p_element, p_array->element_size);
+
+    // Increment the entry counter
+    p_array->count++;
+
+    // Unlock
+    array_unlock_exclusive(p_array);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_array:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for \"p_array\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_element:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for \"p_element\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Unlock
+                array_unlock_exclusive(p_array);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int array_sized_emplace ( array *const p_array, fn_array_emplace *pfn_emplace, void *const p_parameter )
+{
+
+    // Argument check
+    if ( p_array     == (void *) 0 ) goto no_array;
+    if ( pfn_emplace == (void *) 0 ) goto no_emplace;
+
+    // State check
+    if ( p_array->pfn_compare ) goto sorted_array;
+
+    // Initialized data
+    void *p_slot = 0;
+
+    // Lock
+    array_lock_exclusive(p_array);
+
+    // Grow the storage, if there is no room for another element
+    if ( array_storage_reserve(p_array, p_array->count + 1) == 0 ) goto no_mem;
+
+    // Zero the slot
+    p_slot = array_element(p_array, p_array->count);
+    memset(p_slot, 0, p_array->element_size);
+
+    // Construct the element in place
+    if ( pfn_emplace(p_slot, p_parameter) == 0 ) goto failed_to_emplace;
+
+    // Increment the entry counter
+    p_array->count++;
+
+    // Unlock
+    array_unlock_exclusive(p_array);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_array:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for \"p_array\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_emplace:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for \"pfn_emplace\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Array errors
+        {
+            sorted_array:
+                #ifndef NDEBUG
+                    log_error("[array] Can not reorder a sorted array in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            failed_to_emplace:
+                #ifndef NDEBUG
+                    log_error("[array] Failed to construct element in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Unlock
+                array_unlock_exclusive(p_array);
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Unlock
+                array_unlock_exclusive(p_array);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int array_sized_index ( array *const p_array, signed index, void *const p_value )
+{
+
+    // Argument check
+    if ( p_array == (void *) 0 ) goto no_array;
+    if ( p_value == (void *) 0 ) goto no_value;
+
+    // Initialized data
+    size_t _index = 0;
+
+    // Lock
+    array_lock_shared(p_array);
+
+    // Error check
+    if ( array_index_resolve(p_array->count, index, &_index) == false ) goto bounds_error;
+
+    // Return the element
+    memcpy(p_value, array_element(p_array, _index), p_array->element_size);
+
+    // Unlock
+    array_unlock_shared(p_array);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_array:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for \"p_array\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_value:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for \"p_value\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Array errors
+        {
+            bounds_error:
+                #ifndef NDEBUG
+                    log_error("[array] Index out of bounds in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Unlock
+                array_unlock_shared(p_array);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int array_sized_set ( array *const p_array, signed index, const void *const p_value )
+{
+
+    // Argument check
+    if ( p_array == (void *) 0 ) goto no_array;
+    if ( p_value == (void *) 0 ) goto no_value;
+
+    // State check
+    if ( p_array->pfn_compare ) goto sorted_array;
+
+    // Initialized data
+    size_t _index = 0;
+
+    // Lock
+    array_lock_exclusive(p_array);
+
+    // Error check
+    if ( array_index_resolve(p_array->count, index, &_index) == false ) goto bounds_error;
+
+    // Store the element
+    memcpy(array_element(p_array, _index), p_value, p_array->element_size);
+
+    // Unlock
+    array_unlock_exclusive(p_array);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_array:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for \"p_array\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_value:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for \"p_value\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Array errors
+        {
+            sorted_array:
+                #ifndef NDEBUG
+                    log_error("[array] Can not reorder a sorted array in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            bounds_error:
+                #ifndef NDEBUG
+                    log_error("[array] Index out of bounds in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Unlock
+                array_unlock_exclusive(p_array);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int array_sized_remove ( array *const p_array, signed index, void *const p_value )
+{
+
+    // Argument check
+    if ( p_array == (void *) 0 ) goto no_array;
+
+    // Initialized data
+    size_t _index = 0;
+
+    // Lock
+    array_lock_exclusive(p_array);
+
+    // Error check
+    if ( array_index_resolve(p_array->count, index, &_index) == false ) goto bounds_error;
+
+    // Store the element
+    if ( p_value != (void *) 0 ) memcpy(p_value, array_element(p_array, _index), p_array->element_size);
+
+    // Shift the elements after the removed element
+    memmove(array_element(p_array, _index), array_element(p_array, _index + 1), ( p_array->count - _index - 1 ) * p_array->element_size);
+
+    // Decrement the element counter
+    p_array->count--;
+
+    // Give back unused storage
+    array_storage_trim(p_array);
+
+    // Unlock
+    array_unlock_exclusive(p_array);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_array:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for \"p_array\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Array errors
+        {
+            bounds_error:
+                #ifndef NDEBUG
+                    log_error("[array] Index out of bounds in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Unlock
+                array_unlock_exclusive(p_array);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int array_sized_foreach_i ( array *const p_array, fn_array_foreach_i *pfn_array_foreach_i )
+{
+
+    // Argument check
+    if ( p_array             == (void *) 0 ) goto no_array;
+    if ( pfn_array_foreach_i == (void *) 0 ) goto no_function;
+
+    // Lock
+    array_lock_shared(p_array);
+
+    // Iterate over each element in the array
+    for (size_t i = 0; i < p_array->count; i++)
+        
+        // Call the function
+        pfn_array_foreach_i(array_element(p_array, i), i);
+
+    // Unlock
+    array_unlock_shared(p_array);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_array:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for \"p_array\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_function:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for \"pfn_array_foreach_i\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int array_sized_foreach_parallel ( array *const p_array, fn_array_foreach_parallel *pfn_foreach, void *const p_context, size_t grain )
+{
+
+    // Argument check
+    if ( p_array     == (void *) 0 ) goto no_array;
+    if ( pfn_foreach == (void *) 0 ) goto no_function;
+
+    // Initialized data
+    struct array_foreach_job_s foreach = 
+    {
+        .p_array     = p_array,
+        .pfn_foreach = pfn_foreach,
+        .p_context   = p_context,
+        .sized       = true
+    };
+    int result = 0;
+
+    // Lock
+    array_lock_shared(p_array);
+
+    // Call the function on a pointer to each element in the array, in parallel
+    result = array_parallel_for(p_array->count, grain, array_foreach_parallel_range, &foreach);
+
+    // Unlock
+    array_unlock_shared(p_array);
+
+    // Done
+    return result;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_array:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for \"p_array\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_function:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for \"pfn_foreach\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int array_sized_map ( array *const p_array, array **const pp_result, size_t element_size, fn_array_map *pfn_map, void *const p_context, size_t grain )
+{
+
+    // Argument check
+    if ( p_array   == (void *) 0 ) goto no_array;
+    if ( pp_result == (void *) 0 ) goto no_result;
+    if ( pfn_map   == (void *) 0 ) goto no_function;
+
+    // Map a pointer to each element into a new sized array
+    return array_map_locked(p_array, pp_result, element_size, pfn_map, p_context, grain, true);
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_array:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for \"p_array\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_result:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for \"pp_result\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_function:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for \"pfn_map\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int array_sized_filter ( array *const p_array, array **const pp_result, fn_array_filter *pfn_filter, void *const p_context, size_t grain )
+{
 
-// Data
-static bool initialized = false;
+    // Argument check
+    if ( p_array    == (void *) 0 ) goto no_array;
+    if ( pp_result  == (void *) 0 ) goto no_result;
+    if ( pfn_filter == (void *) 0 ) goto no_function;
 
-void array_init ( void ) 
+    // Copy the elements that pass the test into a new array
+    return array_filter_locked(p_array, pp_result, pfn_filter, p_context, grain, true);
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_array:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for \"p_array\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_result:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for \"pp_result\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_function:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for \"pfn_filter\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int array_sized_reduce ( array *const p_array, void *const p_result, size_t result_size, fn_array_reduce *pfn_reduce, fn_array_combine *pfn_combine, void *const p_context, size_t grain )
 {
 
-    // State check
-    if ( initialized == true ) return;
+    // Argument check
+    if ( p_array     == (void *) 0 ) goto no_array;
+    if ( p_result    == (void *) 0 ) goto no_result;
+    if ( pfn_reduce  == (void *) 0 ) goto no_function;
+    if ( pfn_combine == (void *) 0 ) goto no_combine;
+    if ( result_size == 0          ) goto zero_size;
 
-    // Initialize the sync library
-    sync_init();
-    
-    // Initialize the log library
-    log_init();
+    // Fold a pointer to each element into the result
+    return array_reduce_locked(p_array, p_result, result_size, pfn_reduce, pfn_combine, p_context, grain, true);
 
-    // Set the initialized flag
-    initialized = true;
+    // Error handling
+    {
 
-    // Done
-    return; 
+        // Argument errors
+        {
+            no_array:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for \"p_array\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_result:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for \"p_result\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_function:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for \"pfn_reduce\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_combine:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for \"pfn_combine\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            zero_size:
+                #ifndef NDEBUG
+                    log_error("[array] Zero provided for parameter \"result_size\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
 }
 
-int array_create ( array **const pp_array )
+int array_sized_sort ( array *const p_array, fn_array_compare *pfn_compare, void *const p_context )
 {
 
     // Argument check
-    if ( pp_array == (void *) 0 ) goto no_array;
+    if ( p_array     == (void *) 0 ) goto no_array;
+    if ( pfn_compare == (void *) 0 ) goto no_function;
 
-    // Allocate memory for an array
-    array *p_array = ARRAY_REALLOC(0, sizeof(array));
+    // State check
+    if ( p_array->pfn_compare ) goto sorted_array;
 
-    // Error checking
-    if ( p_array == (void *) 0 ) goto no_mem;
+    // Sort the elements
+    return array_sort_locked(p_array, pfn_compare, p_context, false, false);
 
-    // Zero set
-    memset(p_array, 0, sizeof(array));
+    // Error handling
+    {
 
-    // Return the allocated memory
-    *pp_array = p_array;
+        // Argument errors
+        {
+            no_array:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for \"p_array\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
 
-    // Success
-    return 1;
+                // Error
+                return 0;
+
+            no_function:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for \"pfn_compare\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Array errors
+        {
+            sorted_array:
+                #ifndef NDEBUG
+                    log_error("[array] Can not reorder a sorted array in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int array_sized_sort_stable ( array *const p_array, fn_array_compare *pfn_compare, void *const p_context )
+{
+
+    // Argument check
+    if ( p_array     == (void *) 0 ) goto no_array;
+    if ( pfn_compare == (void *) 0 ) goto no_function;
+
+    // State check
+    if ( p_array->pfn_compare ) goto sorted_array;
+
+    // Sort the elements, keeping equal elements in order
+    return array_sort_locked(p_array, pfn_compare, p_context, false, true);
 
     // Error handling
     {
@@ -68,54 +6269,164 @@ int array_create ( array **const pp_array )
         {
             no_array:
                 #ifndef NDEBUG
-                    log_error("[array] Null pointer provided for parameter \"pp_array\" in call to function \"%s\"\n", __FUNCTION__);
+                    log_error("[array] Null pointer provided for \"p_array\" in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
-                // Error 
+                // Error
+                return 0;
+
+            no_function:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for \"pfn_compare\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
                 return 0;
         }
 
-        // Standard library errors
+        // Array errors
         {
-            no_mem:
+            sorted_array:
                 #ifndef NDEBUG
-                    log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                    log_error("[array] Can not reorder a sorted array in call to function \"%s\"\n", __FUNCTION__);
                 #endif
-                
+
                 // Error
                 return 0;
         }
     }
 }
 
-int array_construct ( array **const pp_array, size_t size )
+int array_log ( array *p_array, void *pfn_next, const char *const format, ... )
+{
+
+    // Argument check
+    if ( p_array  == (void *) 0 ) goto no_array;
+    if ( pfn_next == (void *) 0 ) return 0;
+
+    // Print the header
+    log_info("=== %s : %p ===\n", format, p_array);
+
+    // Lock
+    array_lock_shared(p_array);
+
+    // Iterate over each element in the array
+    for (size_t i = 0; i < p_array->count; i++)
+        
+        // TODO: Call the function
+        ; 
+
+    // Unlock
+    array_unlock_shared(p_array);
+
+    // Print a newline
+    putchar('\n');
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_array:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for \"p_array\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int array_destroy ( array **const pp_array )
 {
 
     // Argument check
     if ( pp_array == (void *) 0 ) goto no_array;
-    if ( size     == 0          ) goto zero_size;
 
     // Initialized data
-    array *p_array = 0;
+    array           *p_array   = *pp_array;
+    array_allocator  allocator = { 0 };
 
-    // Allocate an array
-    if ( array_create(&p_array) == 0 ) goto failed_to_create_array;
+    // Lock
+    array_lock_exclusive(p_array);
+
+    // No more pointer for end user
+    *pp_array = (array *) 0;
+
+    // Unlock
+    array_unlock_exclusive(p_array);
+
+    // Destroy the lock
+    array_lock_destroy(p_array);
+
+    // Free storage retired by sequence locked writers
+    array_storage_free_retired(p_array);
+
+    // Free the array contents, unless they are inline
+    if ( array_storage_is_inline(p_array) == false )
+        p_array->p_p_elements = array_allocator_realloc(&p_array->allocator, p_array->p_p_elements, 0);
+
+    // Free the frozen layout
+    if ( p_array->p_frozen )
+        p_array->p_frozen = array_allocator_realloc(&p_array->allocator, p_array->p_frozen, 0);
+
+    // Free the array with a copy of its allocator
+    allocator = p_array->allocator;
+    p_array   = array_allocator_realloc(&allocator, p_array, 0);
     
-    // Set the count and max
-    p_array->count = 0,
-    p_array->max   = size;
+    // Success
+    return 1;
+
+    // Error handling
+    {
 
-    // Allocate "size" number of properties
-    p_array->p_p_elements = ARRAY_REALLOC(0, p_array->max * sizeof(void *));
+        // Argument errors
+        {
+            no_array:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for \"pp_array\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
 
-    // Error checking
-    if ( p_array->p_p_elements == (void *) 0 ) goto no_mem;
+                // Error
+                return 0;
+        }
+    }
+}
+
+int array_arena_construct ( array_arena **const pp_arena, size_t chunk_size )
+{
 
-    // Create a mutex
-    if ( mutex_create(&p_array->_lock) == 0 ) goto failed_to_create_mutex;
+    // Argument check
+    if ( pp_arena   == (void *) 0 ) goto no_arena;
+    if ( chunk_size == 0          ) goto zero_size;
+
+    // Initialized data
+    array_arena *p_arena = ARRAY_REALLOC(0, sizeof(array_arena));
+
+    // Error check
+    if ( p_arena == (void *) 0 ) goto no_mem;
+
+    // Zero set
+    memset(p_arena, 0, sizeof(array_arena));
+
+    // Set the chunk size, and the allocator
+    p_arena->chunk_size = chunk_size,
+    p_arena->allocator  = (array_allocator)
+    {
+        .pfn_realloc = array_arena_realloc,
+        .pfn_free    = (void *) 0,
+        .p_context   = p_arena
+    };
+
+    // Allocate the first chunk
+    if ( array_arena_chunk_add(p_arena, chunk_size) == 0 ) goto failed_to_add_chunk;
 
     // Return a pointer to the caller
-    *pp_array = p_array;
+    *pp_arena = p_arena;
 
     // Success
     return 1;
@@ -125,80 +6436,108 @@ int array_construct ( array **const pp_array, size_t size )
 
         // Argument errors
         {
-            no_array:
+            no_arena:
                 #ifndef NDEBUG
-                    log_error("[array] Null pointer provided for parameter \"pp_array\" in call to function \"%s\"\n", __FUNCTION__);
+                    log_error("[array] Null pointer provided for parameter \"pp_arena\" in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
-                // Error 
+                // Error
                 return 0;
 
             zero_size:
                 #ifndef NDEBUG
-                    log_error("[array] Zero provided for parameter \"size\" in call to function \"%s\"\n", __FUNCTION__);
+                    log_error("[array] Zero provided for parameter \"chunk_size\" in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
-                // Error 
-                return 0;   
+                // Error
+                return 0;
         }
 
         // Array errors
         {
-            failed_to_create_array:
-                #ifndef NDEBUG
-                    log_error("[array] Failed to create array in call to function \"%s\"\n", __FUNCTION__);
-                #endif
+            failed_to_add_chunk:
 
-                // Error 
+                // Free the arena
+                p_arena = ARRAY_REALLOC(p_arena, 0);
+
+                // Error
                 return 0;
-            
-            failed_to_create_mutex:
+        }
+
+        // Standard library errors
+        {
+            no_mem:
                 #ifndef NDEBUG
-                    log_error("[array] Failed to create mutex in call to function \"%s\"\n", __FUNCTION__);
+                    log_error("[Standard library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
-                // Error 
+                // Error
                 return 0;
         }
+    }
+}
 
-        // Standard library errors
+int array_arena_array ( array_arena *const p_arena, array **const pp_array, size_t size, size_t element_size )
+{
+
+    // Argument check
+    if ( p_arena == (void *) 0 ) goto no_arena;
+
+    // Construct an unsynchronized array from the arena
+    return array_construct_allocator(pp_array, size, element_size, ARRAY_SYNC_NONE, &p_arena->allocator);
+
+    // Error handling
+    {
+
+        // Argument errors
         {
-            no_mem:
+            no_arena:
                 #ifndef NDEBUG
-                    log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                    log_error("[array] Null pointer provided for parameter \"p_arena\" in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
-                // Error 
+                // Error
                 return 0;
         }
     }
 }
 
-int array_from_elements ( array **pp_array, void *_p_elements[] )
+int array_arena_reset ( array_arena *const p_arena )
 {
 
     // Argument check
-    if ( pp_array == (void *) 0 ) goto no_array;
-    if ( _p_elements == (void *) 0 ) goto no_elements;
+    if ( p_arena == (void *) 0 ) goto no_arena;
+
+    // Fast exit
+    if ( p_arena->p_chunk == (void *) 0 ) return 1;
 
     // Initialized data
-    array  *p_array       = 0;
-    size_t  element_count = 0;
+    struct array_arena_chunk_s *p_keep  = p_arena->p_chunk,
+                               *p_chunk = p_arena->p_chunk;
 
-    // Count elements
-    while( _p_elements[++element_count] );
+    // Find the oldest of the largest chunks
+    for (p_chunk = p_arena->p_chunk; p_chunk; p_chunk = p_chunk->p_next)
+        if ( p_chunk->size >= p_keep->size ) p_keep = p_chunk;
 
-    // Allocate an array
-    if ( array_construct(&p_array, element_count) == 0 ) goto failed_to_allocate_array;        
+    // Free every other chunk
+    while ( p_arena->p_chunk )
+    {
 
-    // Iterate over each key
-    for (size_t i = 0; _p_elements[i]; i++)
+        // Initialized data
+        struct array_arena_chunk_s *p_next = p_arena->p_chunk->p_next;
 
-        // Add the key to the array
-        array_add(p_array, _p_elements[i]);
+        // Free the chunk
+        if ( p_arena->p_chunk != p_keep ) p_chunk = ARRAY_REALLOC(p_arena->p_chunk, 0);
 
-    // Return
-    *pp_array = p_array;
+        // Next
+        p_arena->p_chunk = p_next;
+    }
+
+    // Empty the largest chunk
+    p_keep->p_next   = (void *) 0,
+    p_keep->top      = 0;
+    p_arena->p_chunk = p_keep,
+    p_arena->p_last  = (void *) 0;
 
     // Success
     return 1;
@@ -208,28 +6547,50 @@ int array_from_elements ( array **pp_array, void *_p_elements[] )
 
         // Argument errors
         {
-            no_array:
+            no_arena:
                 #ifndef NDEBUG
-                    log_error("[array] Null pointer provided for \"pp_array\" in call to function \"%s\"\n", __FUNCTION__);
+                    log_error("[array] Null pointer provided for parameter \"p_arena\" in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
-                // Error 
+                // Error
                 return 0;
+        }
+    }
+}
 
-            no_elements:
-                #ifndef NDEBUG
-                    log_error("[array] Null pointer provided for \"_p_elements\" in call to function \"%s\"\n", __FUNCTION__);
-                #endif
+int array_arena_destroy ( array_arena **const pp_arena )
+{
 
-                // Error 
-                return 0;
-        }
+    // Argument check
+    if ( pp_arena  == (void *) 0 ) goto no_arena;
+    if ( *pp_arena == (void *) 0 ) goto no_arena;
 
-        // Array errors
+    // Initialized data
+    array_arena *p_arena = *pp_arena;
+
+    // No more pointer for end user
+    *pp_arena = (array_arena *) 0;
+
+    // Release every array
+    array_arena_reset(p_arena);
+
+    // Free the first chunk
+    p_arena->p_chunk = ARRAY_REALLOC(p_arena->p_chunk, 0);
+
+    // Free the arena
+    p_arena = ARRAY_REALLOC(p_arena, 0);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
         {
-            failed_to_allocate_array:
+            no_arena:
                 #ifndef NDEBUG
-                    log_error("[array] Call to \"array_construct\" returned an erroneous value in call to function \"%s\"\n", __FUNCTION__);
+                    log_error("[array] Null pointer provided for parameter \"pp_arena\" in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
                 // Error
@@ -238,38 +6599,36 @@ int array_from_elements ( array **pp_array, void *_p_elements[] )
     }
 }
 
-int array_from_arguments ( array **const pp_array, size_t size, size_t element_count, ... )
+int array_pool_construct ( array_pool **const pp_pool, size_t capacity )
 {
 
     // Argument check
-    if ( pp_array == (void *) 0 ) goto no_array;
-
-    // Uninitialized data
-    va_list list;
+    if ( pp_pool  == (void *) 0 ) goto no_pool;
+    if ( capacity == 0          ) goto zero_capacity;
 
     // Initialized data
-    array *p_array = 0;
+    array_pool *p_pool = ARRAY_REALLOC(0, sizeof(array_pool));
 
-    // Initialize the variadic list
-    va_start(list, element_count);
+    // Error check
+    if ( p_pool == (void *) 0 ) goto no_mem;
 
-    // Allocate an array
-    if ( array_construct(&p_array, size) == 0 ) goto failed_to_allocate_array;        
+    // Zero set
+    memset(p_pool, 0, sizeof(array_pool));
 
-    // Iterate over each key
-    for (size_t i = 0; i < element_count; i++)
+    // Allocate room for the released arrays
+    p_pool->pp_free = ARRAY_REALLOC(0, capacity * sizeof(array *));
 
-        // Add the key to the array
-        array_add(p_array, va_arg(list, void *));
-    
-    // Update the element count
-    p_array->count = element_count;
+    // Error check
+    if ( p_pool->pp_free == (void *) 0 ) goto no_mem;
 
-    // End the variadic list
-    va_end(list);
+    // Set the capacity
+    p_pool->max = capacity;
+
+    // Create a lock
+    if ( mutex_create(&p_pool->_lock) == 0 ) goto failed_to_create_lock;
 
     // Return a pointer to the caller
-    *pp_array = p_array;
+    *pp_pool = p_pool;
 
     // Success
     return 1;
@@ -279,151 +6638,238 @@ int array_from_arguments ( array **const pp_array, size_t size, size_t element_c
 
         // Argument errors
         {
-            no_array:
+            no_pool:
                 #ifndef NDEBUG
-                    log_error("[array] Null pointer provided for \"pp_array\" in call to function \"%s\"\n", __FUNCTION__);
+                    log_error("[array] Null pointer provided for parameter \"pp_pool\" in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
-                // Error 
+                // Error
+                return 0;
+
+            zero_capacity:
+                #ifndef NDEBUG
+                    log_error("[array] Zero provided for parameter \"capacity\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
                 return 0;
         }
 
         // Array errors
         {
-            failed_to_allocate_array:
+            failed_to_create_lock:
                 #ifndef NDEBUG
-                    log_error("[array] Call to \"array_construct\" returned an erroneous value in call to function \"%s\"\n", __FUNCTION__);
+                    log_error("[array] Failed to create lock in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
+                // Free the pool
+                p_pool->pp_free = ARRAY_REALLOC(p_pool->pp_free, 0);
+                p_pool          = ARRAY_REALLOC(p_pool, 0);
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Free the pool
+                if ( p_pool ) p_pool = ARRAY_REALLOC(p_pool, 0);
+
                 // Error
                 return 0;
         }
     }
 }
 
-int array_index ( array *const p_array, signed index, void **const pp_value )
+int array_pool_array ( array_pool *const p_pool, array **const pp_array, size_t size, size_t element_size, array_sync sync )
 {
 
-    // Argument errors
-    if ( p_array        == (void *) 0 ) goto no_array;
-    if ( p_array->count ==          0 ) goto no_elements;
-    if ( pp_value       == (void *) 0 ) goto no_value;
+    // Argument check
+    if ( p_pool       == (void *) 0              ) goto no_pool;
+    if ( pp_array     == (void *) 0              ) goto no_array;
+    if ( size         == 0                       ) goto zero_size;
+    if ( element_size == 0                       ) goto zero_element_size;
+    if ( size         >  SIZE_MAX / element_size ) goto size_too_large;
+    if ( sync         >  ARRAY_SYNC_NONE         ) goto bad_sync;
+
+    // Initialized data
+    array  *p_array = 0;
+    size_t  bytes   = 0;
 
     // Lock
-    mutex_lock(&p_array->_lock);
+    mutex_lock(&p_pool->_lock);
 
-    // Error check
-    if ( p_array->count == (size_t) abs(index) ) goto bounds_error;
+    // Take the most recently released array with the same synchronization strategy
+    for (size_t i = p_pool->count; i-- > 0;)
+    {
 
-    // Positive index
-    if ( index >= 0 )
-        *pp_value = p_array->p_p_elements[index];
+        // Skip arrays with a different lock
+        if ( p_pool->pp_free[i]->sync != sync ) continue;
+
+        // Take the array, and fill the gap with the last one
+        p_array            = p_pool->pp_free[i],
+        p_pool->pp_free[i] = p_pool->pp_free[--p_pool->count];
+
+        // Done
+        break;
+    }
 
-    // Negative numbers
-    else 
-        *pp_value = p_array->p_p_elements[p_array->count - (size_t) abs(index)];
+    // Count the hit or the miss
+    if ( p_array ) p_pool->hits++;
+    else           p_pool->misses++;
 
     // Unlock
-    mutex_unlock(&p_array->_lock);
+    mutex_unlock(&p_pool->_lock);
+
+    // Construct a new array on a miss
+    if ( p_array == (void *) 0 ) return array_construct_sized_sync(pp_array, size, element_size, sync);
+
+    // Measure the storage the array kept
+    bytes = ( array_storage_is_inline(p_array) ) ? p_array->inline_bytes : array_storage_bytes(p_array->element_size, p_array->max);
+
+    // Reinterpret the storage with the new element size
+    p_array->element_size = element_size,
+    p_array->max          = bytes / element_size;
+
+    // Grow the storage, if it is too small
+    if ( p_array->max < size )
+        if ( array_storage_resize(p_array, size) == 0 ) goto failed_to_resize;
+
+    // Return a pointer to the caller
+    *pp_array = p_array;
 
     // Success
     return 1;
 
     // Error handling
     {
-        no_array:
-            #ifndef NDEBUG
-                log_error("[array] Null pointer provided for parameter \"p_array\" in call to function \"%s\"\n", __FUNCTION__);
-            #endif
-
-            // Error
-            return 0;
 
-        no_value:
-            #ifndef NDEBUG
-                log_error("[array] Null pointer provided for parameter \"p_value\" in call to function \"%s\"\n", __FUNCTION__);
-            #endif
+        // Argument errors
+        {
+            no_pool:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for parameter \"p_pool\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
 
-            // Error
-            return 0;
+                // Error
+                return 0;
 
-        no_elements:
-            #ifndef NDEBUG
-                log_error("[array] Can not index an empty array in call to function \"%s\"\n", __FUNCTION__);
-            #endif
+            no_array:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for parameter \"pp_array\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
 
-            // Error 
-            return 0;
-        
-        bounds_error:
-            #ifndef NDEBUG
-                log_error("[array] Index out of bounds in call to function \"%s\"\n", __FUNCTION__);
-            #endif
+                // Error
+                return 0;
 
-            // Unlock
-            mutex_unlock(&p_array->_lock);
-            
-            // Error
-            return 0;
-    }
-}
+            zero_size:
+                #ifndef NDEBUG
+                    log_error("[array] Zero provided for parameter \"size\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
 
-int array_get ( array *const p_array, void **const pp_elements, size_t *const p_count )
-{
+                // Error
+                return 0;
 
-    // Argument check
-    if ( p_array == (void *) 0 ) goto no_array;
+            zero_element_size:
+                #ifndef NDEBUG
+                    log_error("[array] Zero provided for parameter \"element_size\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
 
-    // Lock
-    mutex_lock(&p_array->_lock);
+                // Error
+                return 0;
 
-    // Return the elements
-    if ( pp_elements )
-        memcpy(pp_elements, p_array->p_p_elements, (sizeof(void *) * p_array->count) );
-    
-    // Return the count
-    if ( p_count )
-        *p_count = p_array->count;
+            size_too_large:
+                #ifndef NDEBUG
+                    log_error("[array] Parameter \"size\" is too large for the element size in call to function \"%s\"\n", __FUNCTION__);
+                #endif
 
-    // Unlock
-    mutex_unlock(&p_array->_lock);
+                // Error
+                return 0;
 
-    // Success
-    return 1;
+            bad_sync:
+                #ifndef NDEBUG
+                    log_error("[array] Parameter \"sync\" must be a valid synchronization strategy in call to function \"%s\"\n", __FUNCTION__);
+                #endif
 
-    // Error handling
-    {
+                // Error
+                return 0;
+        }
 
-        // Argument errors
+        // Array errors
         {
-            no_array:
+            failed_to_resize:
                 #ifndef NDEBUG
-                    log_error("[array] Null pointer provided for \"p_array\" in call to function \"%s\"\n", __FUNCTION__);
+                    log_error("[array] Failed to resize array in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
-                // Error 
+                // Destroy the array
+                array_destroy(&p_array);
+
+                // Error
                 return 0;
         }
     }
 }
 
-int array_slice ( array *const p_array, void *pp_elements[], signed lower_bound, signed upper_bound )
+int array_pool_release ( array_pool *const p_pool, array **const pp_array )
 {
 
     // Argument check
-    if ( p_array == (void *) 0 ) goto no_array;
-    if ( lower_bound < 0 ) goto erroneous_lower_bound;
-    if ( p_array->count < (size_t) upper_bound ) goto erroneous_upper_bound;
+    if ( p_pool    == (void *) 0 ) goto no_pool;
+    if ( pp_array  == (void *) 0 ) goto no_array;
+    if ( *pp_array == (void *) 0 ) goto no_array;
+
+    // Initialized data
+    array *p_array = *pp_array;
+    bool   cached  = false;
+
+    // No more pointer for end user
+    *pp_array = (array *) 0;
+
+    // Arrays that were never constructed, or use another allocator, can not be reused
+    if ( p_array->p_p_elements         == (void *) 0 ) return array_destroy(&p_array);
+    if ( p_array->allocator.pfn_realloc != (void *) 0 ) return array_destroy(&p_array);
+    if ( p_array->allocator.pfn_free    != (void *) 0 ) return array_destroy(&p_array);
 
     // Lock
-    mutex_lock(&p_array->_lock);
+    array_lock_exclusive(p_array);
+
+    // Empty the array, and restore the default policies. The storage and the lock stay
+    p_array->count        = 0,
+    p_array->growth       = ARRAY_GROWTH_DOUBLE,
+    p_array->increment    = 0,
+    p_array->pfn_growth   = (void *) 0,
+    p_array->shrink_below = 0,
+    p_array->shrink_min   = 0,
+    p_array->pfn_compare  = (void *) 0,
+    p_array->p_compare    = (void *) 0,
+    p_array->by_value     = false;
+
+    // Free retired storage, and the frozen layout
+    array_storage_free_retired(p_array);
+    if ( p_array->p_frozen ) p_array->p_frozen = array_allocator_realloc(&p_array->allocator, p_array->p_frozen, 0);
 
-    // Return the elements
-    if ( pp_elements )
-        memcpy(pp_elements, &p_array->p_p_elements[lower_bound], sizeof(void *) * (size_t) ( upper_bound - lower_bound + 1LL ) );
-    
     // Unlock
-    mutex_unlock(&p_array->_lock);
+    array_unlock_exclusive(p_array);
+
+    // Lock the pool
+    mutex_lock(&p_pool->_lock);
+
+    // Cache the array, if there is room
+    if ( p_pool->count < p_pool->max )
+        p_pool->pp_free[p_pool->count++] = p_array,
+        cached                           = true;
+
+    // Unlock the pool
+    mutex_unlock(&p_pool->_lock);
+
+    // Destroy the array if the pool is full
+    if ( cached == false ) return array_destroy(&p_array);
 
     // Success
     return 1;
@@ -433,62 +6879,52 @@ int array_slice ( array *const p_array, void *pp_elements[], signed lower_bound,
 
         // Argument errors
         {
-            no_array:
+            no_pool:
                 #ifndef NDEBUG
-                    log_error("[array] Null pointer provided for \"p_array\" in call to function \"%s\"\n", __FUNCTION__);
+                    log_error("[array] Null pointer provided for parameter \"p_pool\" in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
-                // Error 
+                // Error
                 return 0;
 
-            erroneous_lower_bound:
-                #ifndef NDEBUG
-                    log_error("[array] Parameter \"lower_bound\" must be greater than zero in call to function \"%s\"\n", __FUNCTION__);
-                #endif
-
-                // Error 
-                return 0;
-                
-            erroneous_upper_bound:
+            no_array:
                 #ifndef NDEBUG
-                    log_error("[array] Parameter \"upper_bound\" must be less than or equal to array size in call to function \"%s\"\n", __FUNCTION__);
+                    log_error("[array] Null pointer provided for parameter \"pp_array\" in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
-                // Error 
+                // Error
                 return 0;
         }
     }
 }
 
-bool array_is_empty ( array *const p_array )
+int array_pool_stats ( array_pool *const p_pool, size_t *const p_hits, size_t *const p_misses )
 {
 
-    // Argument check
-    if ( p_array == (void *) 0 ) goto no_array;
-
-    // Initialized data
-    bool ret = false;
+    // Argument check
+    if ( p_pool == (void *) 0 ) goto no_pool;
 
     // Lock
-    mutex_lock(&p_array->_lock);
+    mutex_lock(&p_pool->_lock);
 
-    // Is empty?
-    ret = ( 0 == p_array->count );
+    // Return the counters to the caller
+    if ( p_hits   ) *p_hits   = p_pool->hits;
+    if ( p_misses ) *p_misses = p_pool->misses;
 
     // Unlock
-    mutex_unlock(&p_array->_lock);
+    mutex_unlock(&p_pool->_lock);
 
     // Success
-    return ret;
+    return 1;
 
     // Error handling
     {
 
         // Argument errors
         {
-            no_array:
+            no_pool:
                 #ifndef NDEBUG
-                    log_error("[array] Null pointer provided for parameter \"p_array\" in call to function \"%s\"\n", __FUNCTION__);
+                    log_error("[array] Null pointer provided for parameter \"p_pool\" in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
                 // Error
@@ -497,23 +6933,41 @@ bool array_is_empty ( array *const p_array )
     }
 }
 
-size_t array_size ( array *const p_array )
+int array_pool_destroy ( array_pool **const pp_pool )
 {
 
     // Argument check
-    if ( p_array == (void *) 0 ) goto no_array;
+    if ( pp_pool  == (void *) 0 ) goto no_pool;
+    if ( *pp_pool == (void *) 0 ) goto no_pool;
+
+    // Initialized data
+    array_pool *p_pool = *pp_pool;
+
+    // No more pointer for end user
+    *pp_pool = (array_pool *) 0;
+
+    // Destroy every released array
+    while ( p_pool->count )
+        array_destroy(&p_pool->pp_free[--p_pool->count]);
+
+    // Destroy the lock
+    mutex_destroy(&p_pool->_lock);
+
+    // Free the pool
+    p_pool->pp_free = ARRAY_REALLOC(p_pool->pp_free, 0);
+    p_pool          = ARRAY_REALLOC(p_pool, 0);
 
     // Success
-    return p_array->count;
+    return 1;
 
     // Error handling
     {
 
         // Argument errors
         {
-            no_array:
+            no_pool:
                 #ifndef NDEBUG
-                    log_error("[array] Null pointer provided for parameter \"p_array\" in call to function \"%s\"\n", __FUNCTION__);
+                    log_error("[array] Null pointer provided for parameter \"pp_pool\" in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
                 // Error
@@ -522,36 +6976,37 @@ size_t array_size ( array *const p_array )
     }
 }
 
-int array_add ( array *p_array, void *p_element )
+int array_pipeline_construct ( array_pipeline **const pp_pipeline, array *const p_array )
 {
 
-    // Argument check
-    if ( p_array == (void *) 0 ) goto no_array;
+    // Construct a pipeline over the values of an array
+    return array_pipeline_create(pp_pipeline, p_array, false);
+}
 
-    // Lock
-    mutex_lock(&p_array->_lock);
+int array_pipeline_construct_sized ( array_pipeline **const pp_pipeline, array *const p_array )
+{
 
-    // Update the iterables
-    p_array->p_p_elements[p_array->count] = p_element;
+    // Construct a pipeline over pointers to the elements of a sized array
+    return array_pipeline_create(pp_pipeline, p_array, true);
+}
 
-    // Increment the entry counter
-    p_array->count++;
+int array_pipeline_filter ( array_pipeline *const p_pipeline, fn_array_filter *pfn_filter, void *const p_context )
+{
 
-    // Resize iterable max?
-    if ( p_array->count >= p_array->max )
+    // Argument check
+    if ( p_pipeline == (void *) 0 ) goto no_pipeline;
+    if ( pfn_filter == (void *) 0 ) goto no_function;
+
+    // Initialized data
+    struct array_pipeline_stage_s stage = 
     {
-    
-        // Double the size
-        p_array->max *= 2;
-    
-        // Reallocate iterable arrays
-        p_array->p_p_elements = ARRAY_REALLOC(p_array->p_p_elements, p_array->max * sizeof(void *));
-    
-        // Error checking
-        if ( p_array == (void *) 0 ) goto no_mem;
-    }
-    
-    mutex_unlock(&p_array->_lock);
+        .kind       = ARRAY_PIPELINE_FILTER,
+        .pfn_filter = pfn_filter,
+        .p_context  = p_context
+    };
+
+    // Add the stage
+    if ( array_pipeline_push(p_pipeline, &stage) == 0 ) goto no_mem;
 
     // Success
     return 1;
@@ -561,9 +7016,17 @@ int array_add ( array *p_array, void *p_element )
 
         // Argument errors
         {
-            no_array:
+            no_pipeline:
                 #ifndef NDEBUG
-                    log_error("[array] Null pointer provided for \"p_array\" in call to function \"%s\"\n", __FUNCTION__);
+                    log_error("[array] Null pointer provided for parameter \"p_pipeline\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_function:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for parameter \"pfn_filter\" in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
                 // Error
@@ -577,41 +7040,41 @@ int array_add ( array *p_array, void *p_element )
                     log_error("[Standard library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
-                // Unlock
-                mutex_unlock(&p_array->_lock);
-
                 // Error
                 return 0;
         }
     }
 }
 
-int array_set ( array *p_array, signed index, void *p_value )
+int array_pipeline_map ( array_pipeline *const p_pipeline, fn_array_map *pfn_map, void *const p_context )
 {
-    
-    // Argument check   
-    if ( p_array == (void *) 0 ) goto no_array;
 
-    // State check
-    if ( p_array->count == 0 ) goto no_elements;
-    
-    // Initialized data
-    size_t _index = 0;
+    // Add a map that writes a value
+    return array_pipeline_add_map(p_pipeline, sizeof(void *), pfn_map, p_context, false);
+}
 
-    // Lock
-    mutex_lock(&p_array->_lock);
+int array_pipeline_sized_map ( array_pipeline *const p_pipeline, size_t element_size, fn_array_map *pfn_map, void *const p_context )
+{
 
-    // Error check
-    if ( p_array->count == (size_t) abs(index) ) goto bounds_error;
+    // Add a map that writes an element
+    return array_pipeline_add_map(p_pipeline, element_size, pfn_map, p_context, true);
+}
 
-    // Store the correct index
-    _index = ( index >= 0 ) ? (size_t) index : (size_t) p_array->count - (size_t) abs(index);
-    
-    // Store the element
-    p_array->p_p_elements[_index] = p_value;
+int array_pipeline_take ( array_pipeline *const p_pipeline, size_t count )
+{
 
-    // Unlock
-    mutex_unlock(&p_array->_lock);
+    // Argument check
+    if ( p_pipeline == (void *) 0 ) goto no_pipeline;
+
+    // Initialized data
+    struct array_pipeline_stage_s stage = 
+    {
+        .kind  = ARRAY_PIPELINE_TAKE,
+        .limit = count
+    };
+
+    // Add the stage
+    if ( array_pipeline_push(p_pipeline, &stage) == 0 ) goto no_mem;
 
     // Success
     return 1;
@@ -621,80 +7084,53 @@ int array_set ( array *p_array, signed index, void *p_value )
 
         // Argument errors
         {
-            no_array:
+            no_pipeline:
                 #ifndef NDEBUG
-                    log_error("[array] Null pointer provided for \"p_array\" in call to function \"%s\"\n", __FUNCTION__);
+                    log_error("[array] Null pointer provided for parameter \"p_pipeline\" in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
                 // Error
                 return 0;
         }
 
-        // Array errors
+        // Standard library errors
         {
-            bounds_error:
+            no_mem:
                 #ifndef NDEBUG
-                    log_error("[array] Index out of bounds in call to function \"%s\"\n", __FUNCTION__);
+                    log_error("[Standard library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
-                // Unlock
-                mutex_unlock(&p_array->_lock);
-
                 // Error
                 return 0;
-
-            no_elements:
-                #ifndef NDEBUG
-                    log_error("[array] Can not index an empty array in call to function \"%s\"\n", __FUNCTION__);
-                #endif
-
-                // Error 
-                return 0;
-        
         }
     }
 }
 
-int array_remove ( array *const p_array, signed index, void **const pp_value )
+int array_pipeline_collect ( array_pipeline *const p_pipeline, array **const pp_result )
 {
 
     // Argument check
-    if ( p_array == (void *) 0 ) goto no_array;
+    if ( p_pipeline == (void *) 0 ) goto no_pipeline;
+    if ( pp_result  == (void *) 0 ) goto no_result;
 
-    // State check
-    if ( p_array->count == 0 ) goto no_elements;
-    
     // Initialized data
-    size_t _index = 0;
-
-    // Lock
-    mutex_lock(&p_array->_lock);
-
-    // Error check
-    if ( p_array->count == (size_t) abs(index) ) goto bounds_error;
+    struct array_pipeline_terminal_s terminal = { 0 };
+    size_t                           size     = p_pipeline->p_array->count;
 
-    // Store the correct index
-    _index = ( index >= 0 ) ? (size_t) index : (size_t) p_array->count - (size_t) abs(index);
-    
-    // Store the element
-    if ( pp_value != (void *) 0 ) *pp_value = p_array->p_p_elements[_index];
-
-    // Edge case
-    if ( (size_t) index == p_array->count-1 ) goto done;
+    // Reserve room for as many elements as the takes pass, so short pipelines collect without growing
+    for (size_t i = 0; i < p_pipeline->count; i++)
+        if ( p_pipeline->p_stages[i].kind == ARRAY_PIPELINE_TAKE && p_pipeline->p_stages[i].limit < size )
+            size = p_pipeline->p_stages[i].limit;
 
-    // Iterate from the index of the removed element to the end of the array
-    for (size_t i = _index; i < p_array->count-1; i++)
-    
-        // Shift elements
-        p_array->p_p_elements[i] = p_array->p_p_elements[i+1];
-
-    done:
+    // Construct the result
+    terminal.sized = array_pipeline_output(p_pipeline, &terminal.element_size);
+    if ( array_construct_sized_sync(&terminal.p_result, ( size ) ? size : 1, terminal.element_size, p_pipeline->p_array->sync) == 0 ) goto failed_to_construct_array;
 
-    // Decrement the element counter
-    p_array->count--;
+    // Collect the elements
+    if ( array_pipeline_run(p_pipeline, array_pipeline_collect_sink, &terminal, SIZE_MAX) == 0 ) goto failed_to_run;
 
-    // Unlock
-    mutex_unlock(&p_array->_lock);
+    // Return a pointer to the caller
+    *pp_result = terminal.p_result;
 
     // Success
     return 1;
@@ -704,9 +7140,17 @@ int array_remove ( array *const p_array, signed index, void **const pp_value )
 
         // Argument errors
         {
-            no_array:
+            no_pipeline:
                 #ifndef NDEBUG
-                    log_error("[array] Null pointer provided for \"p_array\" in call to function \"%s\"\n", __FUNCTION__);
+                    log_error("[array] Null pointer provided for parameter \"p_pipeline\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_result:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for parameter \"pp_result\" in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
                 // Error
@@ -715,113 +7159,104 @@ int array_remove ( array *const p_array, signed index, void **const pp_value )
 
         // Array errors
         {
-            bounds_error:
+            failed_to_construct_array:
                 #ifndef NDEBUG
-                    log_error("[array] Index out of bounds in call to function \"%s\"\n", __FUNCTION__);
+                    log_error("[array] Failed to construct array in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
-                // Unlock
-                mutex_unlock(&p_array->_lock);
-
                 // Error
                 return 0;
 
-            no_elements:
+            failed_to_run:
                 #ifndef NDEBUG
-                    log_error("[array] Can not index an empty array in call to function \"%s\"\n", __FUNCTION__);
+                    log_error("[array] Failed to run pipeline in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
-                // Error 
+                // Destroy the result
+                array_destroy(&terminal.p_result);
+
+                // Error
                 return 0;
-        
         }
     }
 }
 
-int array_clear ( array *const p_array )
+int array_pipeline_count ( array_pipeline *const p_pipeline, size_t *const p_count )
 {
 
     // Argument check
-    if ( p_array == (void *) 0 ) goto no_array;
-
-    // Lock
-    mutex_lock(&p_array->_lock);
+    if ( p_pipeline == (void *) 0 ) goto no_pipeline;
+    if ( p_count    == (void *) 0 ) goto no_count;
 
-    // Clear the entries
-    memset(p_array->p_p_elements, 0, sizeof(void*)*p_array->max);
+    // Initialized data
+    struct array_pipeline_terminal_s terminal = { 0 };
 
-    // Clear the element counter
-    p_array->count = 0;
+    // Count the elements
+    if ( array_pipeline_run(p_pipeline, array_pipeline_count_sink, &terminal, SIZE_MAX) == 0 ) return 0;
 
-    // Unlock
-    mutex_unlock(&p_array->_lock);
+    // Return the count to the caller
+    *p_count = terminal.count;
 
     // Success
     return 1;
 
     // Error handling
     {
-        
+
         // Argument errors
         {
-            no_array:
+            no_pipeline:
                 #ifndef NDEBUG
-                    log_error("[array] Null pointer provided for \"p_array\" in call to function \"%s\"\n", __FUNCTION__);
+                    log_error("[array] Null pointer provided for parameter \"p_pipeline\" in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
                 // Error
                 return 0;
 
+            no_count:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for parameter \"p_count\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
         }
     }
 }
 
-int array_free_clear ( array *const p_array, void (*const free_fun_ptr)(void *) )
+int array_pipeline_first ( array_pipeline *const p_pipeline, void *const p_value )
 {
 
     // Argument check
-    if ( p_array      == (void *) 0 ) goto no_array;
-    if ( free_fun_ptr == (void *) 0 ) goto no_free_func;
-
-    // Lock
-    mutex_lock(&p_array->_lock);
-
-    // Iterate over each element in the array
-    for (size_t i = 0; i < p_array->count; i++)
-    {
-        
-        // Call the free function
-        free_fun_ptr(p_array->p_p_elements[i]);
-
-        // Clear the reference from the array
-        p_array->p_p_elements[i] = 0;
-    }
+    if ( p_pipeline == (void *) 0 ) goto no_pipeline;
+    if ( p_value    == (void *) 0 ) goto no_value;
 
-    // Clear the element counter
-    p_array->count = 0;
+    // Initialized data
+    struct array_pipeline_terminal_s terminal = { .p_value = p_value };
 
-    // Unlock
-    mutex_unlock(&p_array->_lock);
+    // Stop scanning at the first element
+    terminal.sized = array_pipeline_output(p_pipeline, &terminal.element_size);
+    if ( array_pipeline_run(p_pipeline, array_pipeline_first_sink, &terminal, 1) == 0 ) return 0;
 
     // Success
-    return 1;
+    return ( terminal.count == 1 );
 
     // Error handling
     {
-        
+
         // Argument errors
         {
-            no_array:
+            no_pipeline:
                 #ifndef NDEBUG
-                    log_error("[array] Null pointer provided for \"p_array\" in call to function \"%s\"\n", __FUNCTION__);
+                    log_error("[array] Null pointer provided for parameter \"p_pipeline\" in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
                 // Error
                 return 0;
-            
-            no_free_func:
+
+            no_value:
                 #ifndef NDEBUG
-                    log_error("[array] Null pointer provided for \"free_fun_ptr\" in call to function \"%s\"\n", __FUNCTION__);
+                    log_error("[array] Null pointer provided for parameter \"p_value\" in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
                 // Error
@@ -829,45 +7264,40 @@ int array_free_clear ( array *const p_array, void (*const free_fun_ptr)(void *)
         }
     }
 }
- 
-int array_foreach_i ( array *const p_array, fn_array_foreach_i *pfn_array_foreach_i ) 
+
+int array_pipeline_foreach ( array_pipeline *const p_pipeline, fn_array_foreach_parallel *pfn_foreach, void *const p_context )
 {
 
     // Argument check
-    if ( p_array             == (void *) 0 ) goto no_array;
-    if ( pfn_array_foreach_i == (void *) 0 ) goto no_free_func;
-
-    // Lock
-    mutex_lock(&p_array->_lock);
-
-    // Iterate over each element in the array
-    for (size_t i = 0; i < p_array->count; i++)
-        
-        // Call the function
-        pfn_array_foreach_i(p_array->p_p_elements[i], i);
+    if ( p_pipeline  == (void *) 0 ) goto no_pipeline;
+    if ( pfn_foreach == (void *) 0 ) goto no_function;
 
-    // Unlock
-    mutex_unlock(&p_array->_lock);
+    // Initialized data
+    struct array_pipeline_terminal_s terminal = 
+    {
+        .pfn_foreach = pfn_foreach,
+        .p_context   = p_context
+    };
 
-    // Success
-    return 1;
+    // Call the function on each element
+    return array_pipeline_run(p_pipeline, array_pipeline_foreach_sink, &terminal, SIZE_MAX);
 
     // Error handling
     {
-        
+
         // Argument errors
         {
-            no_array:
+            no_pipeline:
                 #ifndef NDEBUG
-                    log_error("[array] Null pointer provided for \"p_array\" in call to function \"%s\"\n", __FUNCTION__);
+                    log_error("[array] Null pointer provided for parameter \"p_pipeline\" in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
                 // Error
                 return 0;
-            
-            no_free_func:
+
+            no_function:
                 #ifndef NDEBUG
-                    log_error("[array] Null pointer provided for \"function\" in call to function \"%s\"\n", __FUNCTION__);
+                    log_error("[array] Null pointer provided for parameter \"pfn_foreach\" in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
                 // Error
@@ -876,42 +7306,49 @@ int array_foreach_i ( array *const p_array, fn_array_foreach_i *pfn_array_foreac
     }
 }
 
-int array_log ( array *p_array, void *pfn_next, const char *const format, ... )
+int array_pipeline_reduce ( array_pipeline *const p_pipeline, void *const p_result, fn_array_reduce *pfn_reduce, void *const p_context )
 {
 
     // Argument check
-    if ( p_array  == (void *) 0 ) goto no_array;
-    if ( pfn_next == (void *) 0 ) return 0;
-
-    // Print the header
-    log_info("=== %s : %p ===\n", format, p_array);
-
-    // Lock
-    mutex_lock(&p_array->_lock);
-
-    // Iterate over each element in the array
-    for (size_t i = 0; i < p_array->count; i++)
-        
-        // TODO: Call the function
-        ; 
+    if ( p_pipeline == (void *) 0 ) goto no_pipeline;
+    if ( p_result   == (void *) 0 ) goto no_result;
+    if ( pfn_reduce == (void *) 0 ) goto no_function;
 
-    // Unlock
-    mutex_unlock(&p_array->_lock);
-
-    // Print a newline
-    putchar('\n');
+    // Initialized data
+    struct array_pipeline_terminal_s terminal = 
+    {
+        .p_value    = p_result,
+        .pfn_reduce = pfn_reduce,
+        .p_context  = p_context
+    };
 
-    // Success
-    return 1;
+    // Fold each element into the result
+    return array_pipeline_run(p_pipeline, array_pipeline_reduce_sink, &terminal, SIZE_MAX);
 
     // Error handling
     {
-        
+
         // Argument errors
         {
-            no_array:
+            no_pipeline:
                 #ifndef NDEBUG
-                    log_error("[array] Null pointer provided for \"p_array\" in call to function \"%s\"\n", __FUNCTION__);
+                    log_error("[array] Null pointer provided for parameter \"p_pipeline\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_result:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for parameter \"p_result\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_function:
+                #ifndef NDEBUG
+                    log_error("[array] Null pointer provided for parameter \"pfn_reduce\" in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
                 // Error
@@ -920,30 +7357,30 @@ int array_log ( array *p_array, void *pfn_next, const char *const format, ... )
     }
 }
 
-int array_destroy ( array **const pp_array )
+int array_pipeline_destroy ( array_pipeline **const pp_pipeline )
 {
 
     // Argument check
-    if ( pp_array == (void *) 0 ) goto no_array;
+    if ( pp_pipeline  == (void *) 0 ) goto no_pipeline;
+    if ( *pp_pipeline == (void *) 0 ) goto no_pipeline;
 
     // Initialized data
-    array *p_array = *pp_array;
-
-    // Lock
-    mutex_lock(&p_array->_lock);
+    array_pipeline *p_pipeline = *pp_pipeline;
 
     // No more pointer for end user
-    *pp_array = (array *) 0;
+    *pp_pipeline = (array_pipeline *) 0;
 
-    // Unlock
-    mutex_unlock(&p_array->_lock);
+    // Free the result of each map
+    for (size_t i = 0; i < p_pipeline->count; i++)
+        if ( p_pipeline->p_stages[i].p_result )
+            p_pipeline->p_stages[i].p_result = ARRAY_REALLOC(p_pipeline->p_stages[i].p_result, 0);
 
-    // Destroy the mutex
-    mutex_destroy(&p_array->_lock);
+    // Free the stages
+    if ( p_pipeline->p_stages ) p_pipeline->p_stages = ARRAY_REALLOC(p_pipeline->p_stages, 0);
+
+    // Free the pipeline
+    p_pipeline = ARRAY_REALLOC(p_pipeline, 0);
 
-    // Free the array
-    p_array = ARRAY_REALLOC(p_array, 0);
-    
     // Success
     return 1;
 
@@ -952,9 +7389,9 @@ int array_destroy ( array **const pp_array )
 
         // Argument errors
         {
-            no_array:
+            no_pipeline:
                 #ifndef NDEBUG
-                    log_error("[array] Null pointer provided for \"pp_array\" in call to function \"%s\"\n", __FUNCTION__);
+                    log_error("[array] Null pointer provided for parameter \"pp_pipeline\" in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
                 // Error
@@ -975,6 +7412,11 @@ void array_exit ( void )
     // Clean up log
     log_exit();
 
+    // Stop the workers
+    #ifndef _WIN64
+        array_workers_stop();
+    #endif
+
     // TODO: Anything else?
     //
 
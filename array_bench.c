@@ -0,0 +1,1823 @@
+/** !
+ * Benchmark for array module
+ *
+ * @file array_bench.c
+ *
+ * @author Jacob Smith
+ */
+
+// Include
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+
+// POSIX
+#include <pthread.h>
+
+// log module
+#include <log/log.h>
+
+// sync module
+#include <sync/sync.h>
+
+// array module
+#include <array/array.h>
+
+// print_time
+#include "print_time.h"
+
+// Preprocessor definitions
+#define ARRAY_BENCH_MIN_SIZE_DEFAULT 16
+#define ARRAY_BENCH_MAX_SIZE_DEFAULT 100000000
+#define ARRAY_BENCH_BUDGET_DEFAULT   (1 << 24)
+
+// Contention defaults
+#define ARRAY_BENCH_READERS_DEFAULT      4
+#define ARRAY_BENCH_WRITERS_DEFAULT      1
+#define ARRAY_BENCH_INITIAL_SIZE_DEFAULT 4096
+#define ARRAY_BENCH_DURATION_DEFAULT     1000
+
+// Latency histograms keep 2^HISTOGRAM_SUB_BUCKET_BITS linear buckets per power of two
+#define HISTOGRAM_SUB_BUCKET_BITS 5
+#define HISTOGRAM_SUB_BUCKETS     (1 << HISTOGRAM_SUB_BUCKET_BITS)
+#define HISTOGRAM_BUCKETS         ((64 - HISTOGRAM_SUB_BUCKET_BITS + 1) * HISTOGRAM_SUB_BUCKETS)
+
+// Enumeration definitions
+enum report_format_e {
+    csv,
+    json
+};
+
+enum contention_operation_e {
+    operation_index,
+    operation_add,
+    operation_set,
+    operation_remove,
+    operation_quantity
+};
+
+// Type definitions
+typedef enum report_format_e report_format_t;
+typedef enum contention_operation_e contention_operation_t;
+
+/** !
+ *  @brief One measured operation at one size
+ */
+typedef struct bench_result_s
+{
+    const char *operation; // Name of the measured function
+    size_t      size,      // Quantity of elements in the array
+                calls;     // Quantity of timed calls
+    double      total_ns;  // Time spent in timed calls
+} bench_result;
+
+/** !
+ *  @brief Log-linear latency histogram in nanoseconds
+ */
+typedef struct histogram_s
+{
+    uint64_t counts[HISTOGRAM_BUCKETS], // Quantity of samples in each bucket
+             total,                     // Quantity of samples
+             max;                       // Largest sample
+} histogram;
+
+/** !
+ *  @brief State of one reader or writer thread
+ */
+typedef struct contention_thread_s
+{
+    pthread_t thread;                           // The thread
+    bool      writer;                           // Writers mutate, readers index
+    uint64_t  seed;                             // Random number generator state
+    histogram histograms[operation_quantity];   // Latency of each successful operation
+    uint64_t  failures[operation_quantity];     // Quantity of failed calls to each operation
+} contention_thread;
+
+// Global variables
+report_format_t format        = csv;
+size_t          min_size      = ARRAY_BENCH_MIN_SIZE_DEFAULT,
+                max_size      = ARRAY_BENCH_MAX_SIZE_DEFAULT,
+                budget        = ARRAY_BENCH_BUDGET_DEFAULT,
+                total_results = 0;
+FILE           *p_report      = (void *) 0;
+array_sync      strategy      = ARRAY_SYNC_MUTEX;
+array_growth    growth        = ARRAY_GROWTH_DOUBLE;
+size_t          increment     = 0;
+
+// Contention configuration
+bool            contention    = false,
+                sweep         = false;
+size_t          readers       = ARRAY_BENCH_READERS_DEFAULT,
+                writers       = ARRAY_BENCH_WRITERS_DEFAULT,
+                initial_size  = ARRAY_BENCH_INITIAL_SIZE_DEFAULT,
+                duration_ms   = ARRAY_BENCH_DURATION_DEFAULT;
+unsigned        mix_add       = 1,
+                mix_set       = 1,
+                mix_remove    = 1;
+
+// Contention state
+array          *p_contended   = (void *) 0;
+int             started       = 0,
+                running       = 0;
+
+// Names of each contention operation
+const char *contention_operation_names[operation_quantity] = {
+    [operation_index]  = "array_index",
+    [operation_add]    = "array_add",
+    [operation_set]    = "array_set",
+    [operation_remove] = "array_remove"
+};
+
+// Written by timed loops so the compiler can't discard them
+volatile uintptr_t sink = 0;
+
+// Forward declarations
+/** !
+ * Convert a pair of timestamps to nanoseconds
+ *
+ * @param t0 the start time
+ * @param t1 the end time
+ *
+ * @return elapsed time in nanoseconds
+ */
+double elapsed_ns ( timestamp t0, timestamp t1 );
+
+/** !
+ * Parse command line arguments into the global configuration
+ *
+ * @param argc the argument count
+ * @param argv the argument vector
+ *
+ * @return 1 on success, 0 on error
+ */
+int parse_arguments ( int argc, const char *argv[] );
+
+/** !
+ * Run every benchmark for every size
+ *
+ * @param void
+ *
+ * @return void
+ */
+void run_benchmarks ( void );
+
+/** !
+ * Construct an empty array with the selected synchronization strategy and growth policy
+ *
+ * @param pp_array return
+ * @param size     the initial capacity
+ *
+ * @return 1 on success, 0 on error
+ */
+int construct_bench ( array **pp_array, size_t size );
+
+/** !
+ * Construct an array of a given size, filled with sequential values
+ *
+ * @param pp_array return
+ * @param size     the quantity of elements
+ *
+ * @return 1 on success, 0 on error
+ */
+int construct_filled ( array **pp_array, size_t size );
+
+/** !
+ * Write the report header
+ *
+ * @param void
+ *
+ * @return void
+ */
+void report_begin ( void );
+
+/** !
+ * Write one result to the report
+ *
+ * @param p_result the result
+ *
+ * @return void
+ */
+void report_result ( const bench_result *p_result );
+
+/** !
+ * Write the report footer
+ *
+ * @param void
+ *
+ * @return void
+ */
+void report_end ( void );
+
+/** !
+ * Benchmark array_add
+ *
+ * @param size the quantity of elements to add
+ *
+ * @return void
+ */
+void bench_add ( size_t size );
+
+/** !
+ * Benchmark array_add_many
+ *
+ * @param size the quantity of elements to add
+ *
+ * @return void
+ */
+void bench_add_many ( size_t size );
+
+/** !
+ * Benchmark array_index
+ *
+ * @param size the quantity of elements in the array
+ *
+ * @return void
+ */
+void bench_index ( size_t size );
+
+/** !
+ * Benchmark array_get
+ *
+ * @param size the quantity of elements in the array
+ *
+ * @return void
+ */
+void bench_get ( size_t size );
+
+/** !
+ * Benchmark array_view_acquire and array_view_release
+ *
+ * @param size the quantity of elements in the array
+ *
+ * @return void
+ */
+void bench_view ( size_t size );
+
+/** !
+ * Benchmark array_slice
+ *
+ * @param size the quantity of elements in the array
+ *
+ * @return void
+ */
+void bench_slice ( size_t size );
+
+/** !
+ * Benchmark array_remove at the head of the array
+ *
+ * @param size the quantity of elements in the array
+ *
+ * @return void
+ */
+void bench_remove ( size_t size );
+
+/** !
+ * Benchmark array_remove_range on the leading half of the array
+ *
+ * @param size the quantity of elements in the array
+ *
+ * @return void
+ */
+void bench_remove_range ( size_t size );
+
+/** !
+ * Benchmark array_set
+ *
+ * @param size the quantity of elements in the array
+ *
+ * @return void
+ */
+void bench_set ( size_t size );
+
+/** !
+ * Benchmark array_foreach_i
+ *
+ * @param size the quantity of elements in the array
+ *
+ * @return void
+ */
+void bench_foreach_i ( size_t size );
+
+/** !
+ * Benchmark array_foreach_parallel
+ *
+ * @param size the quantity of elements in the array
+ *
+ * @return void
+ */
+void bench_foreach_parallel ( size_t size );
+
+/** !
+ * Benchmark array_filter, keeping every other element
+ *
+ * @param size the quantity of elements in the array
+ *
+ * @return void
+ */
+void bench_filter ( size_t size );
+
+/** !
+ * Benchmark array_free_clear
+ *
+ * @param size the quantity of elements in the array
+ *
+ * @return void
+ */
+void bench_free_clear ( size_t size );
+
+/** !
+ * Run the contention benchmark, optionally sweeping the thread count
+ *
+ * @param void
+ *
+ * @return void
+ */
+void run_contention ( void );
+
+/** !
+ * Run readers and writers against one shared array for the configured duration
+ *
+ * @param reader_count the quantity of reader threads
+ * @param writer_count the quantity of writer threads
+ *
+ * @return 1 on success, 0 on error
+ */
+int contention_round ( size_t reader_count, size_t writer_count );
+
+/** !
+ * Body of a contention thread
+ *
+ * @param p_parameter pointer to a contention_thread
+ *
+ * @return null pointer
+ */
+void *contention_worker ( void *p_parameter );
+
+/** !
+ * Next value of a xorshift random number generator
+ *
+ * @param p_seed the generator state
+ *
+ * @return a pseudo random number
+ */
+uint64_t random_next ( uint64_t *p_seed );
+
+/** !
+ * Record a latency sample
+ *
+ * @param p_histogram the histogram
+ * @param value       the latency in nanoseconds
+ *
+ * @return void
+ */
+void histogram_record ( histogram *p_histogram, uint64_t value );
+
+/** !
+ * Add every sample in one histogram to another
+ *
+ * @param p_histogram the destination histogram
+ * @param p_other     the source histogram
+ *
+ * @return void
+ */
+void histogram_merge ( histogram *p_histogram, const histogram *p_other );
+
+/** !
+ * Compute the latency at a percentile
+ *
+ * @param p_histogram the histogram
+ * @param percentile  the percentile, in [0, 100]
+ *
+ * @return the highest latency equivalent to the percentile
+ */
+uint64_t histogram_percentile ( const histogram *p_histogram, double percentile );
+
+/** !
+ * Write one contention result to the report
+ *
+ * @param reader_count the quantity of reader threads
+ * @param writer_count the quantity of writer threads
+ * @param operation    the name of the operation
+ * @param p_histogram  latency of the operation, across every thread
+ * @param failures     the quantity of failed calls, which are not in the histogram
+ * @param seconds      the duration of the round
+ *
+ * @return void
+ */
+void report_contention ( size_t reader_count, size_t writer_count, const char *operation, const histogram *p_histogram, uint64_t failures, double seconds );
+
+/** !
+ * Foreach callback that touches each element
+ *
+ * @param p_value the element
+ * @param i       the index
+ *
+ * @return 1
+ */
+int touch_element ( const void *const p_value, size_t i );
+
+/** !
+ * Parallel foreach callback that touches each element
+ *
+ * @param p_value   the element
+ * @param i         the index
+ * @param p_context unused
+ *
+ * @return 1
+ */
+int touch_element_parallel ( const void *const p_value, size_t i, void *const p_context );
+
+/** !
+ * Filter callback that keeps the elements at even indices
+ *
+ * @param p_value   the element
+ * @param i         the index
+ * @param p_context unused
+ *
+ * @return 1 if the index is even, else 0
+ */
+int keep_even_index ( const void *const p_value, size_t i, void *const p_context );
+
+/** !
+ * Free callback that releases nothing
+ *
+ * @param p_value the element
+ *
+ * @return void
+ */
+void free_nothing ( void *p_value );
+
+// Entry point
+int main ( int argc, const char* argv[] )
+{
+
+    // Initialized data
+    timestamp t0 = 0,
+              t1 = 0;
+
+    // Parse the command line
+    if ( parse_arguments(argc, argv) == 0 ) return EXIT_FAILURE;
+
+    // Start
+    t0 = timer_high_precision();
+
+    // Run benchmarks
+    report_begin();
+
+    if ( contention )
+        run_contention();
+    else
+        run_benchmarks();
+
+    report_end();
+
+    // Stop
+    t1 = timer_high_precision();
+
+    // Report the time it took to run the benchmarks, unless it would pollute the report
+    if ( p_report != stdout )
+    {
+        log_info("array took ");
+        print_time_pretty ( (double)(t1-t0)/(double)timer_seconds_divisor() );
+        log_info(" to benchmark\n");
+
+        // Close the report
+        fclose(p_report);
+    }
+
+    // Flush stdio
+    fflush(stdout);
+
+    // Success
+    return EXIT_SUCCESS;
+}
+
+double elapsed_ns ( timestamp t0, timestamp t1 )
+{
+
+    // Success
+    return (double)(t1 - t0) * 1000000000.0 / (double)timer_seconds_divisor();
+}
+
+int parse_arguments ( int argc, const char *argv[] )
+{
+
+    // Default to stdout
+    p_report = stdout;
+
+    // Iterate over each argument
+    for (int i = 1; i < argc; i++)
+    {
+
+        // Report format
+        if ( strcmp(argv[i], "--format") == 0 && i + 1 < argc )
+        {
+            i++;
+
+            if      ( strcmp(argv[i], "csv")  == 0 ) format = csv;
+            else if ( strcmp(argv[i], "json") == 0 ) format = json;
+            else goto bad_argument;
+        }
+
+        // Synchronization strategy
+        else if ( strcmp(argv[i], "--sync") == 0 && i + 1 < argc )
+        {
+            i++;
+
+            if      ( strcmp(argv[i], "mutex")  == 0 ) strategy = ARRAY_SYNC_MUTEX;
+            else if ( strcmp(argv[i], "rwlock") == 0 ) strategy = ARRAY_SYNC_RWLOCK;
+            else if ( strcmp(argv[i], "seqlock") == 0 ) strategy = ARRAY_SYNC_SEQLOCK;
+            else if ( strcmp(argv[i], "none")    == 0 ) strategy = ARRAY_SYNC_NONE;
+            else goto bad_argument;
+        }
+
+        // Growth policy
+        else if ( strcmp(argv[i], "--growth") == 0 && i + 1 < argc )
+        {
+            i++;
+
+            if      ( strcmp(argv[i], "double") == 0 ) growth = ARRAY_GROWTH_DOUBLE;
+            else if ( strcmp(argv[i], "half")   == 0 ) growth = ARRAY_GROWTH_HALF;
+            else if ( sscanf(argv[i], "fixed:%zu", &increment) == 1 && increment ) growth = ARRAY_GROWTH_FIXED;
+            else goto bad_argument;
+        }
+
+        // Round capacity up to the allocator's usable size
+        else if ( strcmp(argv[i], "--usable-size") == 0 )
+            growth |= ARRAY_GROWTH_USABLE_SIZE;
+
+        // Smallest array size
+        else if ( strcmp(argv[i], "--min-size") == 0 && i + 1 < argc )
+            min_size = strtoull(argv[++i], 0, 10);
+
+        // Largest array size
+        else if ( strcmp(argv[i], "--max-size") == 0 && i + 1 < argc )
+            max_size = strtoull(argv[++i], 0, 10);
+
+        // Element operations per measurement
+        else if ( strcmp(argv[i], "--budget") == 0 && i + 1 < argc )
+            budget = strtoull(argv[++i], 0, 10);
+
+        // Contention mode
+        else if ( strcmp(argv[i], "--contention") == 0 )
+            contention = true;
+
+        // Scale the thread count up to readers + writers
+        else if ( strcmp(argv[i], "--sweep") == 0 )
+            sweep = true;
+
+        // Reader threads
+        else if ( strcmp(argv[i], "--readers") == 0 && i + 1 < argc )
+            readers = strtoull(argv[++i], 0, 10);
+
+        // Writer threads
+        else if ( strcmp(argv[i], "--writers") == 0 && i + 1 < argc )
+            writers = strtoull(argv[++i], 0, 10);
+
+        // Writer operation weights
+        else if ( strcmp(argv[i], "--mix") == 0 && i + 1 < argc )
+        {
+            if ( sscanf(argv[++i], "%u:%u:%u", &mix_add, &mix_set, &mix_remove) != 3 ) goto bad_argument;
+        }
+
+        // Elements in the shared array
+        else if ( strcmp(argv[i], "--initial-size") == 0 && i + 1 < argc )
+            initial_size = strtoull(argv[++i], 0, 10);
+
+        // Length of each round
+        else if ( strcmp(argv[i], "--duration") == 0 && i + 1 < argc )
+            duration_ms = strtoull(argv[++i], 0, 10);
+
+        // Report file
+        else if ( strcmp(argv[i], "--output") == 0 && i + 1 < argc )
+        {
+            p_report = fopen(argv[++i], "w");
+
+            if ( p_report == (void *) 0 ) goto failed_to_open_report;
+        }
+
+        // Unknown
+        else goto bad_argument;
+    }
+
+    // Error check
+    if ( min_size == 0 || min_size > max_size || budget == 0 ) goto bad_sizes;
+    if ( contention && ( readers + writers == 0 || initial_size == 0 || mix_add + mix_set + mix_remove == 0 ) ) goto bad_contention;
+    if ( contention && strategy == ARRAY_SYNC_NONE ) goto bad_contention;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        bad_argument:
+            log_error(
+                "Usage: array_bench [--format csv|json] [--output file] [--sync mutex|rwlock|seqlock|none]\n"\
+                "                   [--growth double|half|fixed:n] [--usable-size]\n"\
+                "                   [--min-size n] [--max-size n] [--budget n]\n"\
+                "                   [--contention [--readers n] [--writers n] [--mix add:set:remove]\n"\
+                "                                 [--initial-size n] [--duration ms] [--sweep]]\n"
+            );
+
+            // Error
+            return 0;
+
+        bad_sizes:
+            log_error("[array bench] Sizes must satisfy 0 < min-size <= max-size, and budget must be nonzero\n");
+
+            // Error
+            return 0;
+
+        bad_contention:
+            log_error("[array bench] Contention needs a synchronized array, at least one thread, a nonzero initial size, and a nonzero mix\n");
+
+            // Error
+            return 0;
+
+        failed_to_open_report:
+            log_error("[Standard library] Failed to open report file in call to function \"%s\"\n", __FUNCTION__);
+
+            // Error
+            return 0;
+    }
+}
+
+void run_benchmarks ( void )
+{
+
+    // Sizes grow by a factor of four, ending at max_size
+    for (size_t size = min_size; ; size *= 4)
+    {
+
+        // Clamp the last size
+        if ( size > max_size ) size = max_size;
+
+        // Run each benchmark
+        bench_add(size);
+        bench_add_many(size);
+        bench_index(size);
+        bench_get(size);
+        bench_view(size);
+        bench_slice(size);
+        bench_remove(size);
+        bench_remove_range(size);
+        bench_set(size);
+        bench_foreach_i(size);
+        bench_foreach_parallel(size);
+        bench_filter(size);
+        bench_free_clear(size);
+
+        // Stop after the largest size
+        if ( size == max_size ) break;
+    }
+
+    // Done
+    return;
+}
+
+int construct_bench ( array **pp_array, size_t size )
+{
+
+    // Construct an array
+    if ( array_construct_sync(pp_array, size, strategy) == 0 ) return 0;
+
+    // Apply the growth policy
+    if ( array_growth_set(*pp_array, growth, increment, (void *) 0) == 0 ) 
+    {
+
+        // Destroy the array
+        array_destroy(pp_array);
+
+        // Error
+        return 0;
+    }
+
+    // Success
+    return 1;
+}
+
+int construct_filled ( array **pp_array, size_t size )
+{
+
+    // Construct an array
+    if ( construct_bench(pp_array, size) == 0 ) return 0;
+
+    // Fill it with non null values
+    for (size_t i = 0; i < size; i++)
+        array_add(*pp_array, (void *)(uintptr_t)(i + 1));
+
+    // Success
+    return 1;
+}
+
+void report_begin ( void )
+{
+
+    // CSV header
+    if ( format == csv )
+        fprintf(p_report, ( contention ) ? "readers,writers,operation,calls,failures,ops_per_second,p50_ns,p99_ns,p999_ns,max_ns\n"
+                                         : "operation,size,calls,total_ns,ns_per_op,ops_per_second\n");
+
+    // JSON header
+    else
+        fprintf(p_report, "{\n  \"%s\" : [", ( contention ) ? "contention" : "benchmarks");
+
+    // Done
+    return;
+}
+
+void report_result ( const bench_result *p_result )
+{
+
+    // Initialized data
+    double ns_per_op      = p_result->total_ns / (double) p_result->calls,
+           ops_per_second = ( ns_per_op > 0.0 ) ? 1000000000.0 / ns_per_op : 0.0;
+
+    // CSV row
+    if ( format == csv )
+        fprintf(p_report, "%s,%zu,%zu,%.0f,%.3f,%.1f\n",
+            p_result->operation, p_result->size, p_result->calls, p_result->total_ns, ns_per_op, ops_per_second
+        );
+
+    // JSON object
+    else
+        fprintf(p_report, "%s\n    { \"operation\" : \"%s\", \"size\" : %zu, \"calls\" : %zu, \"total_ns\" : %.0f, \"ns_per_op\" : %.3f, \"ops_per_second\" : %.1f }",
+            ( total_results ) ? "," : "",
+            p_result->operation, p_result->size, p_result->calls, p_result->total_ns, ns_per_op, ops_per_second
+        );
+
+    // Increment the result counter
+    total_results++;
+
+    // Keep partial results if a large size runs out of memory
+    fflush(p_report);
+
+    // Done
+    return;
+}
+
+void report_end ( void )
+{
+
+    // JSON footer
+    if ( format == json )
+        fprintf(p_report, "\n  ]\n}\n");
+
+    // Done
+    return;
+}
+
+void bench_add ( size_t size )
+{
+
+    // Initialized data
+    bench_result  result  = { .operation = "array_add", .size = size };
+    array        *p_array = 0;
+    size_t        passes  = ( budget / size ) ? budget / size : 1;
+
+    // Each pass grows an array from its smallest capacity
+    for (size_t pass = 0; pass < passes; pass++)
+    {
+
+        // Initialized data
+        timestamp t0 = 0,
+                  t1 = 0;
+
+        // Construct an array with room for one element
+        if ( construct_bench(&p_array, 1) == 0 ) return;
+
+        // Start
+        t0 = timer_high_precision();
+
+        // Add each element
+        for (size_t i = 0; i < size; i++)
+            array_add(p_array, (void *)(uintptr_t)(i + 1));
+
+        // Stop
+        t1 = timer_high_precision();
+
+        // Accumulate
+        result.total_ns += elapsed_ns(t0, t1),
+        result.calls    += size;
+
+        // Destroy the array
+        array_destroy(&p_array);
+    }
+
+    // Report
+    report_result(&result);
+
+    // Done
+    return;
+}
+
+void bench_add_many ( size_t size )
+{
+
+    // Initialized data
+    bench_result   result      = { .operation = "array_add_many", .size = size };
+    array         *p_array     = 0;
+    size_t         passes      = ( budget / size ) ? budget / size : 1;
+    void         **pp_elements = ARRAY_REALLOC(0, size * sizeof(void *));
+
+    // Error check
+    if ( pp_elements == (void *) 0 ) return;
+
+    // Fill the buffer with non null values
+    for (size_t i = 0; i < size; i++)
+        pp_elements[i] = (void *)(uintptr_t)(i + 1);
+
+    // Each pass grows an array from its smallest capacity
+    for (size_t pass = 0; pass < passes; pass++)
+    {
+
+        // Initialized data
+        timestamp t0 = 0,
+                  t1 = 0;
+
+        // Construct an array with room for one element
+        if ( construct_bench(&p_array, 1) == 0 ) break;
+
+        // Start
+        t0 = timer_high_precision();
+
+        // Add every element at once
+        array_add_many(p_array, pp_elements, size);
+
+        // Stop
+        t1 = timer_high_precision();
+
+        // Accumulate
+        result.total_ns += elapsed_ns(t0, t1),
+        result.calls    += 1;
+
+        // Destroy the array
+        array_destroy(&p_array);
+    }
+
+    // Report
+    if ( result.calls ) report_result(&result);
+
+    // Free the buffer
+    pp_elements = ARRAY_REALLOC(pp_elements, 0);
+
+    // Done
+    return;
+}
+
+void bench_index ( size_t size )
+{
+
+    // Initialized data
+    bench_result  result  = { .operation = "array_index", .size = size };
+    array        *p_array = 0;
+    size_t        passes  = ( budget / size ) ? budget / size : 1;
+    void         *p_value = 0;
+    timestamp     t0      = 0,
+                  t1      = 0;
+
+    // Construct a full array
+    if ( construct_filled(&p_array, size) == 0 ) return;
+
+    // Start
+    t0 = timer_high_precision();
+
+    // Index each element
+    for (size_t pass = 0; pass < passes; pass++)
+        for (size_t i = 0; i < size; i++)
+        {
+            array_index(p_array, (signed) i, &p_value);
+            sink += (uintptr_t) p_value;
+        }
+
+    // Stop
+    t1 = timer_high_precision();
+
+    // Store the result
+    result.total_ns = elapsed_ns(t0, t1),
+    result.calls    = passes * size;
+
+    // Destroy the array
+    array_destroy(&p_array);
+
+    // Report
+    report_result(&result);
+
+    // Done
+    return;
+}
+
+void bench_get ( size_t size )
+{
+
+    // Initialized data
+    bench_result   result      = { .operation = "array_get", .size = size };
+    array         *p_array     = 0;
+    size_t         calls       = ( budget / size ) ? budget / size : 1,
+                   count       = 0;
+    void         **pp_elements = ARRAY_REALLOC(0, size * sizeof(void *));
+    timestamp      t0          = 0,
+                   t1          = 0;
+
+    // Error check
+    if ( pp_elements == (void *) 0 ) return;
+
+    // Construct a full array
+    if ( construct_filled(&p_array, size) == 0 ) goto done;
+
+    // Start
+    t0 = timer_high_precision();
+
+    // Copy the contents out of the array
+    for (size_t i = 0; i < calls; i++)
+    {
+        array_get(p_array, pp_elements, &count);
+        sink += (uintptr_t) pp_elements[count - 1];
+    }
+
+    // Stop
+    t1 = timer_high_precision();
+
+    // Store the result
+    result.total_ns = elapsed_ns(t0, t1),
+    result.calls    = calls;
+
+    // Destroy the array
+    array_destroy(&p_array);
+
+    // Report
+    report_result(&result);
+
+    done:
+
+    // Free the buffer
+    pp_elements = ARRAY_REALLOC(pp_elements, 0);
+
+    // Done
+    return;
+}
+
+void bench_view ( size_t size )
+{
+
+    // Initialized data
+    bench_result        result      = { .operation = "array_view", .size = size };
+    array              *p_array     = 0;
+    size_t              calls       = ( budget / size ) ? budget / size : 1,
+                        count       = 0;
+    const void *const  *pp_elements = 0;
+    timestamp           t0          = 0,
+                        t1          = 0;
+
+    // Construct a full array
+    if ( construct_filled(&p_array, size) == 0 ) return;
+
+    // Start
+    t0 = timer_high_precision();
+
+    // Borrow the contents of the array
+    for (size_t i = 0; i < calls; i++)
+    {
+        array_view_acquire(p_array, &pp_elements, &count);
+        sink += (uintptr_t) pp_elements[count - 1];
+        array_view_release(p_array);
+    }
+
+    // Stop
+    t1 = timer_high_precision();
+
+    // Store the result
+    result.total_ns = elapsed_ns(t0, t1),
+    result.calls    = calls;
+
+    // Destroy the array
+    array_destroy(&p_array);
+
+    // Report
+    report_result(&result);
+
+    // Done
+    return;
+}
+
+void bench_slice ( size_t size )
+{
+
+    // Initialized data
+    bench_result   result      = { .operation = "array_slice", .size = size };
+    array         *p_array     = 0;
+    size_t         calls       = ( budget / size ) ? budget / size : 1;
+    void         **pp_elements = ARRAY_REALLOC(0, size * sizeof(void *));
+    timestamp      t0          = 0,
+                   t1          = 0;
+
+    // Error check
+    if ( pp_elements == (void *) 0 ) return;
+
+    // Construct a full array
+    if ( construct_filled(&p_array, size) == 0 ) goto done;
+
+    // Start
+    t0 = timer_high_precision();
+
+    // Copy the whole array out as a slice
+    for (size_t i = 0; i < calls; i++)
+    {
+        array_slice(p_array, pp_elements, 0, (signed) size - 1);
+        sink += (uintptr_t) pp_elements[0];
+    }
+
+    // Stop
+    t1 = timer_high_precision();
+
+    // Store the result
+    result.total_ns = elapsed_ns(t0, t1),
+    result.calls    = calls;
+
+    // Destroy the array
+    array_destroy(&p_array);
+
+    // Report
+    report_result(&result);
+
+    done:
+
+    // Free the buffer
+    pp_elements = ARRAY_REALLOC(pp_elements, 0);
+
+    // Done
+    return;
+}
+
+void bench_remove ( size_t size )
+{
+
+    // Initialized data
+    bench_result  result  = { .operation = "array_remove", .size = size };
+    array        *p_array = 0;
+    size_t        calls   = ( budget / size ) ? budget / size : 1;
+    void         *p_value = 0;
+    timestamp     t0      = 0,
+                  t1      = 0;
+
+    // Removing from the head shifts the whole array, so never drain more than half of it
+    if ( calls > size / 2 ) calls = ( size / 2 ) ? size / 2 : 1;
+
+    // Construct a full array
+    if ( construct_filled(&p_array, size) == 0 ) return;
+
+    // Start
+    t0 = timer_high_precision();
+
+    // Remove from the head
+    for (size_t i = 0; i < calls; i++)
+    {
+        array_remove(p_array, 0, &p_value);
+        sink += (uintptr_t) p_value;
+    }
+
+    // Stop
+    t1 = timer_high_precision();
+
+    // Store the result
+    result.total_ns = elapsed_ns(t0, t1),
+    result.calls    = calls;
+
+    // Destroy the array
+    array_destroy(&p_array);
+
+    // Report
+    report_result(&result);
+
+    // Done
+    return;
+}
+
+void bench_remove_range ( size_t size )
+{
+
+    // Initialized data
+    bench_result   result      = { .operation = "array_remove_range", .size = size };
+    array         *p_array     = 0;
+    size_t         calls       = ( budget / size ) ? budget / size : 1,
+                   half        = ( size / 2 ) ? size / 2 : 1;
+    void         **pp_elements = ARRAY_REALLOC(0, size * sizeof(void *));
+
+    // Error check
+    if ( pp_elements == (void *) 0 ) return;
+
+    // Fill the buffer with non null values
+    for (size_t i = 0; i < size; i++)
+        pp_elements[i] = (void *)(uintptr_t)(i + 1);
+
+    // Construct an array
+    if ( construct_bench(&p_array, size) == 0 ) goto done;
+
+    // Each call trims a full array
+    for (size_t i = 0; i < calls; i++)
+    {
+
+        // Initialized data
+        timestamp t0 = 0,
+                  t1 = 0;
+
+        // Refill the array
+        array_clear(p_array);
+        array_add_many(p_array, pp_elements, size);
+
+        // Start
+        t0 = timer_high_precision();
+
+        // Remove the leading half, keeping a copy
+        array_remove_range(p_array, 0, (signed) half - 1, pp_elements);
+
+        // Stop
+        t1 = timer_high_precision();
+
+        // Accumulate
+        result.total_ns += elapsed_ns(t0, t1),
+        result.calls    += 1;
+    }
+
+    // Destroy the array
+    array_destroy(&p_array);
+
+    // Report
+    report_result(&result);
+
+    done:
+
+    // Free the buffer
+    pp_elements = ARRAY_REALLOC(pp_elements, 0);
+
+    // Done
+    return;
+}
+
+void bench_set ( size_t size )
+{
+
+    // Initialized data
+    bench_result  result  = { .operation = "array_set", .size = size };
+    array        *p_array = 0;
+    size_t        passes  = ( budget / size ) ? budget / size : 1;
+    timestamp     t0      = 0,
+                  t1      = 0;
+
+    // Construct a full array
+    if ( construct_filled(&p_array, size) == 0 ) return;
+
+    // Start
+    t0 = timer_high_precision();
+
+    // Overwrite each element
+    for (size_t pass = 0; pass < passes; pass++)
+        for (size_t i = 0; i < size; i++)
+            array_set(p_array, (signed) i, (void *)(uintptr_t)(pass + i + 1));
+
+    // Stop
+    t1 = timer_high_precision();
+
+    // Store the result
+    result.total_ns = elapsed_ns(t0, t1),
+    result.calls    = passes * size;
+
+    // Destroy the array
+    array_destroy(&p_array);
+
+    // Report
+    report_result(&result);
+
+    // Done
+    return;
+}
+
+void bench_foreach_i ( size_t size )
+{
+
+    // Initialized data
+    bench_result  result  = { .operation = "array_foreach_i", .size = size };
+    array        *p_array = 0;
+    size_t        calls   = ( budget / size ) ? budget / size : 1;
+    timestamp     t0      = 0,
+                  t1      = 0;
+
+    // Construct a full array
+    if ( construct_filled(&p_array, size) == 0 ) return;
+
+    // Start
+    t0 = timer_high_precision();
+
+    // Visit each element
+    for (size_t i = 0; i < calls; i++)
+        array_foreach_i(p_array, touch_element);
+
+    // Stop
+    t1 = timer_high_precision();
+
+    // Store the result
+    result.total_ns = elapsed_ns(t0, t1),
+    result.calls    = calls;
+
+    // Destroy the array
+    array_destroy(&p_array);
+
+    // Report
+    report_result(&result);
+
+    // Done
+    return;
+}
+
+void bench_foreach_parallel ( size_t size )
+{
+
+    // Initialized data
+    bench_result  result  = { .operation = "array_foreach_parallel", .size = size };
+    array        *p_array = 0;
+    size_t        calls   = ( budget / size ) ? budget / size : 1;
+    timestamp     t0      = 0,
+                  t1      = 0;
+
+    // Construct a full array
+    if ( construct_filled(&p_array, size) == 0 ) return;
+
+    // Start
+    t0 = timer_high_precision();
+
+    // Visit each element
+    for (size_t i = 0; i < calls; i++)
+        array_foreach_parallel(p_array, touch_element_parallel, (void *) 0, 0);
+
+    // Stop
+    t1 = timer_high_precision();
+
+    // Store the result
+    result.total_ns = elapsed_ns(t0, t1),
+    result.calls    = calls;
+
+    // Destroy the array
+    array_destroy(&p_array);
+
+    // Report
+    report_result(&result);
+
+    // Done
+    return;
+}
+
+void bench_filter ( size_t size )
+{
+
+    // Initialized data
+    bench_result  result   = { .operation = "array_filter", .size = size };
+    array        *p_array  = 0,
+                 *p_result = 0;
+    size_t        calls    = ( budget / size ) ? budget / size : 1;
+    timestamp     t0       = 0,
+                  t1       = 0;
+
+    // Construct a full array
+    if ( construct_filled(&p_array, size) == 0 ) return;
+
+    // Start
+    t0 = timer_high_precision();
+
+    // Each call constructs, and destroys, an array of every other element
+    for (size_t i = 0; i < calls; i++)
+        if ( array_filter(p_array, &p_result, keep_even_index, (void *) 0, 0) )
+            array_destroy(&p_result);
+
+    // Stop
+    t1 = timer_high_precision();
+
+    // Store the result
+    result.total_ns = elapsed_ns(t0, t1),
+    result.calls    = calls;
+
+    // Destroy the array
+    array_destroy(&p_array);
+
+    // Report
+    report_result(&result);
+
+    // Done
+    return;
+}
+
+void bench_free_clear ( size_t size )
+{
+
+    // Initialized data
+    bench_result  result  = { .operation = "array_free_clear", .size = size };
+    array        *p_array = 0;
+    size_t        calls   = ( budget / size ) ? budget / size : 1;
+
+    // Construct an array
+    if ( construct_bench(&p_array, size) == 0 ) return;
+
+    // Each call clears a full array
+    for (size_t i = 0; i < calls; i++)
+    {
+
+        // Initialized data
+        timestamp t0 = 0,
+                  t1 = 0;
+
+        // Refill the array
+        for (size_t j = 0; j < size; j++)
+            array_add(p_array, (void *)(uintptr_t)(j + 1));
+
+        // Start
+        t0 = timer_high_precision();
+
+        // Release every element
+        array_free_clear(p_array, free_nothing);
+
+        // Stop
+        t1 = timer_high_precision();
+
+        // Accumulate
+        result.total_ns += elapsed_ns(t0, t1),
+        result.calls    += 1;
+    }
+
+    // Destroy the array
+    array_destroy(&p_array);
+
+    // Report
+    report_result(&result);
+
+    // Done
+    return;
+}
+
+void run_contention ( void )
+{
+
+    // Initialized data
+    size_t total = readers + writers;
+
+    // Single round
+    if ( sweep == false )
+    {
+        contention_round(readers, writers);
+
+        // Done
+        return;
+    }
+
+    // Double the thread count each round, keeping the reader to writer ratio
+    for (size_t threads = 1; ; threads *= 2)
+    {
+
+        // Initialized data
+        size_t reader_count = 0,
+               writer_count = 0;
+
+        // Clamp the last round
+        if ( threads > total ) threads = total;
+
+        // Split the threads
+        reader_count = ( threads * readers + total / 2 ) / total;
+        writer_count = threads - reader_count;
+
+        // Keep at least one writer when there are writers to keep
+        if ( writers && writer_count == 0 && threads > 1 ) writer_count = 1, reader_count = threads - 1;
+
+        // Run the round
+        if ( contention_round(reader_count, writer_count) == 0 ) return;
+
+        // Stop after the largest round
+        if ( threads == total ) break;
+    }
+
+    // Done
+    return;
+}
+
+int contention_round ( size_t reader_count, size_t writer_count )
+{
+
+    // Initialized data
+    size_t             thread_count = reader_count + writer_count,
+                       created      = 0;
+    contention_thread *p_threads    = calloc(thread_count, sizeof(contention_thread));
+    histogram         *p_merged     = calloc(operation_quantity + 1, sizeof(histogram));
+    uint64_t           failures[operation_quantity + 1] = { 0 };
+    struct timespec    duration     = { .tv_sec = (time_t)(duration_ms / 1000), .tv_nsec = (long)(duration_ms % 1000) * 1000000L };
+    timestamp          t0           = 0,
+                       t1           = 0;
+    double             seconds      = 0.0;
+
+    // Error check
+    if ( p_threads == (void *) 0 || p_merged == (void *) 0 ) goto no_mem;
+
+    // Construct the shared array
+    if ( construct_filled(&p_contended, initial_size) == 0 ) goto failed_to_construct;
+
+    // Reset the flags
+    __atomic_store_n(&started, 0, __ATOMIC_RELEASE);
+    __atomic_store_n(&running, 1, __ATOMIC_RELEASE);
+
+    // Start each thread
+    for (size_t i = 0; i < thread_count; i++)
+    {
+        p_threads[i].writer = ( i >= reader_count ),
+        p_threads[i].seed   = 0x9E3779B97F4A7C15ULL * (i + 1);
+
+        if ( pthread_create(&p_threads[i].thread, 0, contention_worker, &p_threads[i]) ) goto failed_to_create_thread;
+
+        // Count the thread, so it can be joined on error
+        created++;
+    }
+
+    // Release the threads together
+    t0 = timer_high_precision();
+    __atomic_store_n(&started, 1, __ATOMIC_RELEASE);
+
+    // Let them contend
+    nanosleep(&duration, 0);
+
+    // Stop the threads
+    __atomic_store_n(&running, 0, __ATOMIC_RELEASE);
+
+    // Wait for each thread
+    for (size_t i = 0; i < thread_count; i++)
+        pthread_join(p_threads[i].thread, 0);
+
+    t1 = timer_high_precision();
+    seconds = elapsed_ns(t0, t1) / 1000000000.0;
+
+    // Merge each thread's histograms
+    for (size_t i = 0; i < thread_count; i++)
+        for (size_t j = 0; j < operation_quantity; j++)
+        {
+            histogram_merge(&p_merged[j], &p_threads[i].histograms[j]);
+            histogram_merge(&p_merged[operation_quantity], &p_threads[i].histograms[j]);
+            failures[j]                  += p_threads[i].failures[j];
+            failures[operation_quantity] += p_threads[i].failures[j];
+        }
+
+    // Report each operation that ran
+    for (size_t j = 0; j < operation_quantity; j++)
+        if ( p_merged[j].total || failures[j] )
+            report_contention(reader_count, writer_count, contention_operation_names[j], &p_merged[j], failures[j], seconds);
+
+    // Report the aggregate
+    report_contention(reader_count, writer_count, "total", &p_merged[operation_quantity], failures[operation_quantity], seconds);
+
+    // Destroy the shared array
+    array_destroy(&p_contended);
+
+    // Free the thread state
+    free(p_threads);
+    free(p_merged);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Standard library errors
+        {
+            no_mem:
+                log_error("[Standard library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+
+                // Free the thread state
+                free(p_threads);
+                free(p_merged);
+
+                // Error
+                return 0;
+
+            failed_to_construct:
+                log_error("[array bench] Failed to construct shared array in call to function \"%s\"\n", __FUNCTION__);
+
+                // Free the thread state
+                free(p_threads);
+                free(p_merged);
+
+                // Error
+                return 0;
+        }
+
+        // POSIX errors
+        {
+            failed_to_create_thread:
+                log_error("[pthread] Failed to create thread in call to function \"%s\"\n", __FUNCTION__);
+
+                // Abort the round. Release the threads that started, and stop them at once
+                __atomic_store_n(&running, 0, __ATOMIC_RELEASE);
+                __atomic_store_n(&started, 1, __ATOMIC_RELEASE);
+
+                // Wait for each thread that started
+                for (size_t i = 0; i < created; i++)
+                    pthread_join(p_threads[i].thread, 0);
+
+                // Destroy the shared array
+                array_destroy(&p_contended);
+
+                // Free the thread state
+                free(p_threads);
+                free(p_merged);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+void *contention_worker ( void *p_parameter )
+{
+
+    // Initialized data
+    contention_thread *p_thread = p_parameter;
+    unsigned           mix      = mix_add + mix_set + mix_remove;
+
+    // Wait for the other threads
+    while ( __atomic_load_n(&started, __ATOMIC_ACQUIRE) == 0 );
+
+    // Run until stopped
+    while ( __atomic_load_n(&running, __ATOMIC_ACQUIRE) )
+    {
+
+        // Initialized data
+        uint64_t                r         = random_next(&p_thread->seed);
+        size_t                  size      = array_size(p_contended);
+        signed                  index     = ( size ) ? (signed)( (r >> 32) % size ) : 0;
+        void                   *p_value   = 0;
+        contention_operation_t  operation = operation_index;
+        int                     ok        = 0;
+        timestamp               t0        = 0,
+                                t1        = 0;
+
+        // Writers choose an operation by weight
+        if ( p_thread->writer )
+        {
+
+            // Initialized data
+            unsigned pick = (unsigned)( r % mix );
+
+            operation = ( pick < mix_add           ) ? operation_add
+                      : ( pick < mix_add + mix_set ) ? operation_set
+                      :                                operation_remove;
+
+            // Nothing to set or remove in an empty array
+            if ( size == 0 ) operation = operation_add;
+        }
+
+        // Nothing to read in an empty array
+        else if ( size == 0 ) continue;
+
+        // Start
+        t0 = timer_high_precision();
+
+        // Run the operation
+        switch ( operation )
+        {
+            case operation_index:
+                ok = array_index(p_contended, index, &p_value);
+                break;
+
+            case operation_add:
+                ok = array_add(p_contended, (void *)(uintptr_t)(r | 1));
+                break;
+
+            case operation_set:
+                ok = array_set(p_contended, index, (void *)(uintptr_t)(r | 1));
+                break;
+
+            case operation_remove:
+            default:
+                ok = array_remove(p_contended, index, &p_value);
+                break;
+        }
+
+        // Stop
+        t1 = timer_high_precision();
+
+        // Another thread shrank the array since its size was read. Count the failure, without its latency
+        if ( ok == 0 ) p_thread->failures[operation]++;
+
+        // Record the latency
+        else histogram_record(&p_thread->histograms[operation], (uint64_t) elapsed_ns(t0, t1));
+    }
+
+    // Done
+    return (void *) 0;
+}
+
+uint64_t random_next ( uint64_t *p_seed )
+{
+
+    // Initialized data
+    uint64_t x = *p_seed;
+
+    // xorshift64
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+
+    // Store the state
+    *p_seed = x;
+
+    // Success
+    return x;
+}
+
+void histogram_record ( histogram *p_histogram, uint64_t value )
+{
+
+    // Initialized data
+    size_t index = value;
+
+    // Values past the linear range share a bucket with their nearest 2^HISTOGRAM_SUB_BUCKET_BITS neighbours
+    if ( value >= HISTOGRAM_SUB_BUCKETS )
+    {
+
+        // Initialized data
+        unsigned magnitude = 63U - (unsigned) __builtin_clzll(value);
+
+        index = (size_t)( magnitude - HISTOGRAM_SUB_BUCKET_BITS + 1 ) * HISTOGRAM_SUB_BUCKETS
+              + (size_t)( ( value >> ( magnitude - HISTOGRAM_SUB_BUCKET_BITS ) ) - HISTOGRAM_SUB_BUCKETS );
+    }
+
+    // Store the sample
+    p_histogram->counts[index]++;
+    p_histogram->total++;
+    if ( value > p_histogram->max ) p_histogram->max = value;
+
+    // Done
+    return;
+}
+
+void histogram_merge ( histogram *p_histogram, const histogram *p_other )
+{
+
+    // Add each bucket
+    for (size_t i = 0; i < HISTOGRAM_BUCKETS; i++)
+        p_histogram->counts[i] += p_other->counts[i];
+
+    // Update the totals
+    p_histogram->total += p_other->total;
+    if ( p_other->max > p_histogram->max ) p_histogram->max = p_other->max;
+
+    // Done
+    return;
+}
+
+uint64_t histogram_percentile ( const histogram *p_histogram, double percentile )
+{
+
+    // Initialized data
+    uint64_t target     = (uint64_t)( (double) p_histogram->total * percentile / 100.0 + 0.5 ),
+             cumulative = 0;
+
+    // Always report at least the first sample
+    if ( target == 0 ) target = 1;
+
+    // Walk the buckets
+    for (size_t i = 0; i < HISTOGRAM_BUCKETS; i++)
+    {
+
+        // Initialized data
+        uint64_t highest = i;
+
+        // Accumulate
+        cumulative += p_histogram->counts[i];
+
+        // Keep walking
+        if ( cumulative < target ) continue;
+
+        // Highest value that maps to this bucket
+        if ( i >= HISTOGRAM_SUB_BUCKETS )
+        {
+
+            // Initialized data
+            unsigned shift = (unsigned)( i / HISTOGRAM_SUB_BUCKETS ) - 1;
+
+            highest = ( ( (uint64_t) HISTOGRAM_SUB_BUCKETS + i % HISTOGRAM_SUB_BUCKETS ) << shift ) + ( 1ULL << shift ) - 1;
+        }
+
+        // Success
+        return ( highest < p_histogram->max ) ? highest : p_histogram->max;
+    }
+
+    // Empty histogram
+    return p_histogram->max;
+}
+
+void report_contention ( size_t reader_count, size_t writer_count, const char *operation, const histogram *p_histogram, uint64_t failures, double seconds )
+{
+
+    // Initialized data
+    double ops_per_second = ( seconds > 0.0 ) ? (double) p_histogram->total / seconds : 0.0;
+
+    // CSV row
+    if ( format == csv )
+        fprintf(p_report, "%zu,%zu,%s,%llu,%llu,%.1f,%llu,%llu,%llu,%llu\n",
+            reader_count, writer_count, operation,
+            (unsigned long long) p_histogram->total,
+            (unsigned long long) failures,
+            ops_per_second,
+            (unsigned long long) histogram_percentile(p_histogram, 50.0),
+            (unsigned long long) histogram_percentile(p_histogram, 99.0),
+            (unsigned long long) histogram_percentile(p_histogram, 99.9),
+            (unsigned long long) p_histogram->max
+        );
+
+    // JSON object, with every nonempty bucket
+    else
+    {
+        fprintf(p_report, "%s\n    { \"readers\" : %zu, \"writers\" : %zu, \"operation\" : \"%s\", \"calls\" : %llu, \"failures\" : %llu, \"ops_per_second\" : %.1f, \"p50_ns\" : %llu, \"p99_ns\" : %llu, \"p999_ns\" : %llu, \"max_ns\" : %llu, \"histogram\" : [",
+            ( total_results ) ? "," : "",
+            reader_count, writer_count, operation,
+            (unsigned long long) p_histogram->total,
+            (unsigned long long) failures,
+            ops_per_second,
+            (unsigned long long) histogram_percentile(p_histogram, 50.0),
+            (unsigned long long) histogram_percentile(p_histogram, 99.0),
+            (unsigned long long) histogram_percentile(p_histogram, 99.9),
+            (unsigned long long) p_histogram->max
+        );
+
+        // Each bucket is a [ lowest_ns, count ] pair
+        for (size_t i = 0, written = 0; i < HISTOGRAM_BUCKETS; i++)
+        {
+
+            // Initialized data
+            uint64_t lowest = i;
+
+            // Skip empty buckets
+            if ( p_histogram->counts[i] == 0 ) continue;
+
+            // Lowest value that maps to this bucket
+            if ( i >= HISTOGRAM_SUB_BUCKETS )
+                lowest = ( (uint64_t) HISTOGRAM_SUB_BUCKETS + i % HISTOGRAM_SUB_BUCKETS ) << ( i / HISTOGRAM_SUB_BUCKETS - 1 );
+
+            fprintf(p_report, "%s[%llu,%llu]", ( written++ ) ? "," : "", (unsigned long long) lowest, (unsigned long long) p_histogram->counts[i]);
+        }
+
+        fprintf(p_report, "] }");
+    }
+
+    // Increment the result counter
+    total_results++;
+
+    // Flush the report
+    fflush(p_report);
+
+    // Done
+    return;
+}
+
+int touch_element ( const void *const p_value, size_t i )
+{
+
+    // Supress compiler warnings
+    (void) i;
+
+    // Touch the element
+    sink += (uintptr_t) p_value;
+
+    // Success
+    return 1;
+}
+
+int touch_element_parallel ( const void *const p_value, size_t i, void *const p_context )
+{
+
+    // Supress compiler warnings. Writing the sink from every worker would measure contention instead
+    (void) p_value;
+    (void) i;
+    (void) p_context;
+
+    // Success
+    return 1;
+}
+
+int keep_even_index ( const void *const p_value, size_t i, void *const p_context )
+{
+
+    // Supress compiler warnings
+    (void) p_value;
+    (void) p_context;
+
+    // Success
+    return ( i % 2 == 0 );
+}
+
+void free_nothing ( void *p_value )
+{
+
+    // Touch the element
+    sink += (uintptr_t) p_value;
+
+    // Done
+    return;
+}
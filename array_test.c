@@ -20,6 +20,9 @@
 // array module
 #include <array/array.h>
 
+// print_time
+#include "print_time.h"
+
 // Enumeration definitions
 enum result_e {
     zero,
@@ -27,8 +30,14 @@ enum result_e {
     match
 };
 
+// Structure definitions
+struct record_s {
+    long long a, b, c, d;
+};
+
 // Type definitions
 typedef enum result_e result_t;
+typedef struct record_s record;
 
 // Global variables
 int total_tests      = 0,
@@ -51,26 +60,49 @@ char  *A_element      = "A",
       *AB_elements [] = { "A", "B", 0x0 },
       *BC_elements [] = { "B", "C", 0x0 },
       *AC_elements [] = { "A", "C", 0x0 },
+      *CB_elements [] = { "C", "B", 0x0 },
       *ABC_elements[] = { "A", "B", "C", 0x0 };
 
+// Possible records
+const record A_record       = { 1, 2, 3, 4 },
+             B_record       = { 5, 6, 7, 8 },
+             C_record       = { 9, 10, 11, 12 },
+             D_record       = { 13, 14, 15, 16 },
+             ABC_records[]  = { { 1, 2, 3, 4 }, { 5, 6, 7, 8 }, { 9, 10, 11, 12 } };
+
+// Synchronization strategy of constructed arrays
+array_sync  test_sync        = ARRAY_SYNC_MUTEX;
+
+// Running sum of sum_record
+long long   record_sum       = 0;
+
+// Allocations made and still live through the counting allocator
+size_t      allocations[2]   = { 0, 0 };
+
+// Arena of arena constructed arrays
+array_arena *p_test_arena    = 0;
+
+// Pool of pool constructed arrays
+array_pool  *p_test_pool     = 0;
+
 // Forward declarations
 /** !
- * Print the time formatted in days, hours, minutes, seconds, miliseconds, microseconds
+ * Run all the tests
  * 
- * @param seconds the time in seconds
+ * @param void
  * 
  * @return void
  */
-void print_time_pretty ( double seconds );
+void run_tests ( void );
 
 /** !
- * Run all the tests
+ * Run every scenario with the current synchronization strategy
  * 
  * @param void
  * 
  * @return void
  */
-void run_tests ( void );
+void run_scenarios ( void );
 
 /** !
  * Print a summary of the test scenario
@@ -137,6 +169,18 @@ bool test_get ( void (*array_constructor)(array **), void **expected_values, res
  */
 bool test_get_count ( void(*array_constructor)(array **pp_array), size_t expected_size, result_t expected );
 
+/** !
+ * Test the view functions
+ * 
+ * @param array_constructor array constructor function
+ * @param expected_values   the expected values of the view
+ * @param expected_size     the expected quantity of elements in the view
+ * @param expected          < zero | one | match > 
+ * 
+ * @return true if test passes, false if test fails
+ */
+bool test_view ( void(*array_constructor)(array **pp_array), void **expected_values, size_t expected_size, result_t expected );
+
 /** !
  * Test the size function
  * 
@@ -173,6 +217,269 @@ bool test_index ( void(*array_constructor)(array **pp_array), signed idx, void *
  */
 bool test_slice ( void(*array_constructor)(array **pp_array), signed lower, signed upper, void **expected_value, result_t expected );
 
+/** !
+ * Test the remove range function
+ * 
+ * @param array_constructor array constructor function
+ * @param lower             the lower bound of the range
+ * @param upper             the upper bound of the range
+ * @param expected_value    the expected values of the removed elements
+ * @param expected          < zero | one | match > 
+ * 
+ * @return true if test passes, false if test fails
+ */
+bool test_remove_range ( void(*array_constructor)(array **pp_array), signed lower, signed upper, void **expected_value, result_t expected );
+
+/** !
+ * Test the capacity function
+ * 
+ * @param array_constructor array constructor function
+ * @param expected_capacity the expected capacity of the array
+ * @param expected          < zero | one | match > 
+ * 
+ * @return true if test passes, false if test fails
+ */
+bool test_capacity ( void(*array_constructor)(array **pp_array), size_t expected_capacity, result_t expected );
+
+/** !
+ * Test the sized index function
+ * 
+ * @param array_constructor array constructor function
+ * @param idx               the index to access
+ * @param expected_value    the expected record at the index
+ * @param expected          < zero | one | match > 
+ * 
+ * @return true if test passes, false if test fails
+ */
+bool test_sized_index ( void(*array_constructor)(array **pp_array), signed idx, const record *expected_value, result_t expected );
+
+/** !
+ * Test the sized remove function
+ * 
+ * @param array_constructor array constructor function
+ * @param idx               the index to remove
+ * @param expected_value    the expected record at the index
+ * @param expected          < zero | one | match > 
+ * 
+ * @return true if test passes, false if test fails
+ */
+bool test_sized_remove ( void(*array_constructor)(array **pp_array), signed idx, const record *expected_value, result_t expected );
+
+/** !
+ * Test the sized foreach function
+ * 
+ * @param array_constructor array constructor function
+ * @param expected_sum      the expected sum of the first field of each record
+ * @param expected          < zero | one | match > 
+ * 
+ * @return true if test passes, false if test fails
+ */
+bool test_sized_foreach_i ( void(*array_constructor)(array **pp_array), long long expected_sum, result_t expected );
+
+/** !
+ * Test that an arena array grows in place while it is the arena's most recent allocation
+ * 
+ * @param expected          < zero | one | match > 
+ * 
+ * @return true if test passes, false if test fails
+ */
+bool test_arena_grow_in_place ( result_t expected );
+
+/** !
+ * Test that resetting an arena reuses its memory
+ * 
+ * @param expected          < zero | one | match > 
+ * 
+ * @return true if test passes, false if test fails
+ */
+bool test_arena_reset ( result_t expected );
+
+/** !
+ * Test that a pool reuses a released array, and counts the hit and the miss
+ * 
+ * @param expected          < zero | one | match > 
+ * 
+ * @return true if test passes, false if test fails
+ */
+bool test_pool_reuse ( result_t expected );
+
+/** !
+ * Test that a pool only reuses arrays with the same synchronization strategy, and destroys arrays it has no room for
+ * 
+ * @param expected          < zero | one | match > 
+ * 
+ * @return true if test passes, false if test fails
+ */
+bool test_pool_mismatch ( result_t expected );
+
+/** !
+ * Test that array_sized_foreach_parallel visits each element of [0, 1, ..., count - 1] once
+ * 
+ * @param count             the quantity of elements
+ * @param grain             elements claimed at a time
+ * @param expected          < zero | one | match > 
+ * 
+ * @return true if test passes, false if test fails
+ */
+bool test_foreach_parallel ( size_t count, size_t grain, result_t expected );
+
+/** !
+ * Test that array_foreach_parallel visits every element, and fails if one call fails
+ * 
+ * @param expected          < zero | one | match > 
+ * 
+ * @return true if test passes, false if test fails
+ */
+bool test_foreach_parallel_error ( result_t expected );
+
+/** !
+ * Test that array_sized_foreach_parallel runs when called from inside a parallel call
+ * 
+ * @param expected          < zero | one | match > 
+ * 
+ * @return true if test passes, false if test fails
+ */
+bool test_foreach_parallel_nested ( result_t expected );
+
+/** !
+ * Test that sorting records by their first field orders them, and that a stable sort keeps equal records in order
+ * 
+ * @param count             the quantity of records
+ * @param keys              the quantity of distinct first fields
+ * @param stable            true for array_sized_sort_stable, false for array_sized_sort
+ * @param expected          < zero | one | match > 
+ * 
+ * @return true if test passes, false if test fails
+ */
+bool test_sort ( size_t count, size_t keys, bool stable, result_t expected );
+
+/** !
+ * Test that a sorted array stays ordered, and that array_lower_bound and array_find_sorted agree with a linear scan
+ * 
+ * @param count             the quantity of records
+ * @param keys              the quantity of distinct first fields
+ * @param frozen            freeze the array before searching, then add a record so the frozen layout is stale, and search again
+ * @param expected          < zero | one | match > 
+ * 
+ * @return true if test passes, false if test fails
+ */
+bool test_sorted_search ( size_t count, size_t keys, bool frozen, result_t expected );
+
+/** !
+ * Check array_lower_bound and array_find_sorted against a linear scan for every key
+ * 
+ * @param p_array           a sorted array of records
+ * @param keys              the quantity of distinct first fields
+ * 
+ * @return true if every search agrees with the scan, else false
+ */
+bool check_sorted_search ( array *p_array, size_t keys );
+
+/** !
+ * Test that functions that would reorder a sorted array fail
+ * 
+ * @param expected          < zero | one | match > 
+ * 
+ * @return true if test passes, false if test fails
+ */
+bool test_sorted_reorder ( result_t expected );
+
+/** !
+ * Test that array_sized_map squares [0, 1, ..., count - 1], array_sized_filter keeps the even squares in order, 
+ * and array_sized_reduce sums them
+ * 
+ * @param count             the quantity of elements
+ * @param grain             elements in each chunk, or 0 for ARRAY_PARALLEL_GRAIN
+ * @param expected          < zero | one | match > 
+ * 
+ * @return true if test passes, false if test fails
+ */
+bool test_transform ( size_t count, size_t grain, result_t expected );
+
+/** !
+ * Test that array_map fails, and returns no array, if one call fails
+ * 
+ * @param expected          < zero | one | match > 
+ * 
+ * @return true if test passes, false if test fails
+ */
+bool test_transform_error ( result_t expected );
+
+/** !
+ * Test that a pipeline over [0, 1, ..., count - 1] that keeps even elements, squares them, and takes 10 
+ * produces the same elements from every terminal, and stops scanning once the take is full
+ * 
+ * @param count             the quantity of elements
+ * @param expected          < zero | one | match > 
+ * 
+ * @return true if test passes, false if test fails
+ */
+bool test_pipeline ( size_t count, result_t expected );
+
+/** !
+ * Test that a pipeline that passes nothing, and a take of nothing, leave nothing, and that a take of nothing 
+ * reads no elements
+ * 
+ * @param expected          < zero | one | match > 
+ * 
+ * @return true if test passes, false if test fails
+ */
+bool test_pipeline_empty ( result_t expected );
+
+/** !
+ * Test that functions for arrays of pointers fail on sized arrays with smaller elements
+ * 
+ * @param expected          < zero | one | match > 
+ * 
+ * @return true if test passes, false if test fails
+ */
+bool test_pointer_functions_sized ( result_t expected );
+
+/** !
+ * Test that reserving, or constructing, more elements than fit in memory fails, and leaves the array usable
+ * 
+ * @param expected          < zero | one | match > 
+ * 
+ * @return true if test passes, false if test fails
+ */
+bool test_reserve_overflow ( result_t expected );
+
+/** !
+ * Test that growth policies which would overflow the capacity still grow the array to a usable size
+ * 
+ * @param expected          < zero | one | match > 
+ * 
+ * @return true if test passes, false if test fails
+ */
+bool test_growth_overflow ( result_t expected );
+
+/** !
+ * Test that a sequence locked array keeps less retired storage than live storage, whatever its policies
+ * 
+ * @param expected          < zero | one | match > 
+ * 
+ * @return true if test passes, false if test fails
+ */
+bool test_seqlock_retired ( result_t expected );
+
+/** !
+ * Test that a construction that fails to allocate its storage gives back everything it allocated
+ * 
+ * @param expected          < zero | one | match > 
+ * 
+ * @return true if test passes, false if test fails
+ */
+bool test_construct_no_mem ( result_t expected );
+
+/** !
+ * Test that removing many elements with a duplicate or out of bounds index fails before returning any element
+ * 
+ * @param expected          < zero | one | match > 
+ * 
+ * @return true if test passes, false if test fails
+ */
+bool test_remove_unordered_many_invalid ( result_t expected );
+
 /** !
  * Test an array with no elements
  * 
@@ -216,6 +523,17 @@ void test_two_element_array ( void (*array_constructor)(array **), char *name, v
  */
 void test_three_element_array ( void (*array_constructor)(array **), char *name, void **values );
 
+/** !
+ * Test a sized array with three records
+ * 
+ * @param array_constructor function to construct array
+ * @param name              the name of the test
+ * @param values            the expected records of the array
+ * 
+ * @return void
+ */
+void test_sized_three_element_array ( void (*array_constructor)(array **), char *name, const record *values );
+
 /** !
  * Construct an empty array, return the result 
  * 
@@ -253,85 +571,139 @@ void construct_A_addB_AB ( array **pp_array );
 void construct_AB_addC_ABC ( array **pp_array );
 
 /** !
- * Construct an [A, B, C] array, clear the array, return the result 
+ * Construct an empty array with room for one element, add "A", "B" and "C" at once, return the result 
  * 
- * @param pp_array []
+ * @param pp_array [A, B, C]
  * 
  * @return void
  */
-void construct_ABC_clear_empty ( array **pp_array );
+void construct_empty_addmanyABC_ABC ( array **pp_array );
 
 /** !
- * Construct an [A, B] array, clear the array, return the result 
+ * Construct an [A] array, add "B" and "C" at once, return the result 
  * 
- * @param pp_array []
+ * @param pp_array [A, B, C]
  * 
  * @return void
  */
-void construct_AB_clear_empty ( array **pp_array );
+void construct_A_addmanyBC_ABC ( array **pp_array );
 
 /** !
- * Construct an [A] array, clear the array, return the result 
+ * Construct an [A, C] array, insert "B" at 1, return the result 
  * 
- * @param pp_array []
+ * @param pp_array [A, B, C]
  * 
  * @return void
  */
-void construct_A_clear_empty ( array **pp_array );
+void construct_AC_insert1B_ABC ( array **pp_array );
 
 /** !
- * Construct an [A, B, C] array, return the result 
+ * Construct a [B, C] array, insert "A" at -2, return the result 
  * 
  * @param pp_array [A, B, C]
  * 
  * @return void
  */
-void construct_empty_fromelementsABC_ABC ( array **pp_array );
+void construct_BC_insertneg2A_ABC ( array **pp_array );
 
 /** !
- * Construct an [A, B] array, return the result 
+ * Construct an [A] array, insert "B" and "C" at 1, return the result 
  * 
- * @param pp_array [A, B]
+ * @param pp_array [A, B, C]
  * 
  * @return void
  */
-void construct_empty_fromelementsAB_AB ( array **pp_array );
+void construct_A_insertmany1BC_ABC ( array **pp_array );
 
 /** !
- * Construct an [A] array, return the result 
+ * Construct a [C] array, insert "A" and "B" at 0, return the result 
  * 
- * @param pp_array [A]
+ * @param pp_array [A, B, C]
  * 
  * @return void
  */
-void construct_empty_fromelementsA_A ( array **pp_array );
+void construct_C_insertmany0AB_ABC ( array **pp_array );
 
 /** !
- * Construct an [A, B, C] array, return the result 
+ * Construct an [A, B, C] array, clear the array, return the result 
  * 
- * @param pp_array [A, B, C]
+ * @param pp_array []
  * 
  * @return void
  */
-void construct_empty_fromargumentsABC_ABC ( array **pp_array );
+void construct_ABC_clear_empty ( array **pp_array );
 
 /** !
- * Construct an [A, B] array, return the result 
+ * Construct an [A, B] array, clear the array, return the result 
  * 
- * @param pp_array [A, B]
+ * @param pp_array []
  * 
  * @return void
  */
-void construct_empty_fromargumentsAB_AB ( array **pp_array );
+void construct_AB_clear_empty ( array **pp_array );
 
 /** !
- * Construct an [A] array, return the result 
+ * Construct an [A] array, clear the array, return the result 
  * 
- * @param pp_array [A]
+ * @param pp_array []
  * 
  * @return void
  */
-void construct_empty_fromargumentsA_A ( array **pp_array );
+void construct_A_clear_empty ( array **pp_array );
+
+/** !
+ * Construct an [A, B, C] array, return the result 
+ * 
+ * @param pp_array [A, B, C]
+ * 
+ * @return void
+ */
+void construct_empty_fromelementsABC_ABC ( array **pp_array );
+
+/** !
+ * Construct an [A, B] array, return the result 
+ * 
+ * @param pp_array [A, B]
+ * 
+ * @return void
+ */
+void construct_empty_fromelementsAB_AB ( array **pp_array );
+
+/** !
+ * Construct an [A] array, return the result 
+ * 
+ * @param pp_array [A]
+ * 
+ * @return void
+ */
+void construct_empty_fromelementsA_A ( array **pp_array );
+
+/** !
+ * Construct an [A, B, C] array, return the result 
+ * 
+ * @param pp_array [A, B, C]
+ * 
+ * @return void
+ */
+void construct_empty_fromargumentsABC_ABC ( array **pp_array );
+
+/** !
+ * Construct an [A, B] array, return the result 
+ * 
+ * @param pp_array [A, B]
+ * 
+ * @return void
+ */
+void construct_empty_fromargumentsAB_AB ( array **pp_array );
+
+/** !
+ * Construct an [A] array, return the result 
+ * 
+ * @param pp_array [A]
+ * 
+ * @return void
+ */
+void construct_empty_fromargumentsA_A ( array **pp_array );
 
 /** !
  * Construct an [A] array, remove 0, return the result 
@@ -342,6 +714,60 @@ void construct_empty_fromargumentsA_A ( array **pp_array );
  */
 void construct_A_remove0_empty ( array **pp_array );
 
+/** !
+ * Construct an [A, B, C] array, remove 0 without preserving order, return the result 
+ * 
+ * @param pp_array [C, B]
+ * 
+ * @return void
+ */
+void construct_ABC_removeunordered0_CB ( array **pp_array );
+
+/** !
+ * Construct an [A, B, C] array, remove 1 without preserving order, return the result 
+ * 
+ * @param pp_array [A, C]
+ * 
+ * @return void
+ */
+void construct_ABC_removeunordered1_AC ( array **pp_array );
+
+/** !
+ * Construct an [A, B, C] array, remove 0 and 2 without preserving order, return the result 
+ * 
+ * @param pp_array [B]
+ * 
+ * @return void
+ */
+void construct_ABC_removeunorderedmany02_B ( array **pp_array );
+
+/** !
+ * Construct an [A, B, C] array, remove 0 through 1, return the result 
+ * 
+ * @param pp_array [C]
+ * 
+ * @return void
+ */
+void construct_ABC_removerange01_C ( array **pp_array );
+
+/** !
+ * Construct an [A, B, C] array, remove 1 through 2, return the result 
+ * 
+ * @param pp_array [A]
+ * 
+ * @return void
+ */
+void construct_ABC_removerange12_A ( array **pp_array );
+
+/** !
+ * Construct an [A, B, C] array, remove 0 through 2, return the result 
+ * 
+ * @param pp_array []
+ * 
+ * @return void
+ */
+void construct_ABC_removerange02_empty ( array **pp_array );
+
 /** !
  * Construct an [A, B] array, remove 1, return the result 
  * 
@@ -352,691 +778,3196 @@ void construct_A_remove0_empty ( array **pp_array );
 void construct_AB_remove1_A ( array **pp_array );
 
 /** !
- * Construct an [A, B, C] array, remove 2, return the result 
+ * Construct an [A, B, C] array, add ten "D"s, remove 3 through 12, return the result 
+ * 
+ * @param pp_array [A, B, C]
+ * 
+ * @return void
+ */
+void construct_ABC_add10Dremoverange312_ABC ( array **pp_array );
+
+/** !
+ * Construct an empty array in one allocation with room for three elements, add "A", "B" and "C", return the result 
+ * 
+ * @param pp_array [A, B, C]
+ * 
+ * @return void
+ */
+void construct_inline_empty_addABC_ABC ( array **pp_array );
+
+/** !
+ * Construct an empty array in one allocation with room for one element, add "A", "B" and "C", return the result 
+ * 
+ * @param pp_array [A, B, C]
+ * 
+ * @return void
+ */
+void construct_inline1_empty_addABC_ABC ( array **pp_array );
+
+/** !
+ * Construct an empty array with the counting allocator, add "A", "B" and "C", reserve 16 elements, return the result 
+ * 
+ * @param pp_array [A, B, C]
+ * 
+ * @return void
+ */
+void construct_allocator_empty_addABCreserve16_ABC ( array **pp_array );
+
+/** !
+ * Construct an empty array in the test arena, add "A", "B" and "C", add ten "D"s, remove 3 through 12, return the result 
+ * 
+ * @param pp_array [A, B, C]
+ * 
+ * @return void
+ */
+void construct_arena_empty_addABC10Dremoverange312_ABC ( array **pp_array );
+
+/** !
+ * Construct an array from the test pool, add ten "D"s, release it, construct another array from the test pool, add "A", "B" and "C", return the result 
+ * 
+ * @param pp_array [A, B, C]
+ * 
+ * @return void
+ */
+void construct_pool_10Dreleased_addABC_ABC ( array **pp_array );
+
+/** !
+ * Count allocations, then reallocate with the standard library
+ * 
+ * @param p_context pointer to the allocation counters
+ * @param p_memory  the memory to reallocate, or null
+ * @param size      the new size in bytes
+ * 
+ * @return the memory on success, null on error
+ */
+void *counting_realloc ( void *p_context, void *p_memory, size_t size );
+
+/** !
+ * Count frees, then free with the standard library
+ * 
+ * @param p_context pointer to the allocation counters
+ * @param p_memory  the memory to free
+ * 
+ * @return void
+ */
+void counting_free ( void *p_context, void *p_memory );
+
+/** !
+ * Count allocations like counting_realloc, but fail every allocation after the first
+ * 
+ * @param p_context pointer to the allocation counters
+ * @param p_memory  the memory to reallocate, or null to allocate
+ * @param size      the size of the allocation
+ * 
+ * @return the memory on success, null on error
+ */
+void *failing_realloc ( void *p_context, void *p_memory, size_t size );
+
+/** !
+ * Construct an empty array, reserve 16 elements, return the result 
+ * 
+ * @param pp_array []
+ * 
+ * @return void
+ */
+void construct_empty_reserve16_empty ( array **pp_array );
+
+/** !
+ * Construct an [A, B, C] array with room for sixteen elements, shrink below one quarter, remove 2, return the result 
  * 
  * @param pp_array [A, B]
  * 
  * @return void
  */
-void construct_ABC_remove2_AB  ( array **pp_array );   
+void construct_ABC_shrinkpolicyremove2_AB ( array **pp_array );
 
-// Entry point
-int main ( int argc, const char* argv[] )
-{
-    
-    // Supress compiler warnings
-    (void) argc;
-    (void) argv;
+/** !
+ * Construct an [A, B, C] array with room for sixteen elements, shrink below one quarter, clear, return the result 
+ * 
+ * @param pp_array []
+ * 
+ * @return void
+ */
+void construct_ABC_shrinkpolicyclear_empty ( array **pp_array );
 
-    // Initialized data
-    timestamp t0 = 0,
-              t1 = 0;
+/** !
+ * Construct an empty array with room for two elements, grow it by half, add A, B, and C, return the result 
+ * 
+ * @param pp_array [A, B, C]
+ * 
+ * @return void
+ */
+void construct_empty_growthhalfaddABC_ABC ( array **pp_array );
 
-    // Formatting
-    printf(
-        "╭──────────────╮\n"\
-        "│ array tester │\n"\
-        "╰──────────────╯\n\n"
-    );
-    
-    // Start
-    t0 = timer_high_precision();
+/** !
+ * Construct an empty array with room for two elements, grow it by five, add A, B, and C, return the result 
+ * 
+ * @param pp_array [A, B, C]
+ * 
+ * @return void
+ */
+void construct_empty_growthfixed5addABC_ABC ( array **pp_array );
 
-    // Run tests
-    run_tests();
+/** !
+ * Construct an empty array with room for two elements, grow it with a callback, add A, B, and C, return the result 
+ * 
+ * @param pp_array [A, B, C]
+ * 
+ * @return void
+ */
+void construct_empty_growthcallbackaddABC_ABC ( array **pp_array );
 
-    // Stop
-    t1 = timer_high_precision();
+/** !
+ * Construct an empty array with room for one element, round growth up to the usable size, add A, B, and C, return the result 
+ * 
+ * @param pp_array [A, B, C]
+ * 
+ * @return void
+ */
+void construct_empty_growthusableaddABC_ABC ( array **pp_array );
 
-    // Report the time it took to run the tests
-    log_info("array took ");
-    print_time_pretty ( (double)(t1-t0)/(double)timer_seconds_divisor() );
-    log_info(" to test\n");
+/** !
+ * Grow an array to exactly the required capacity
+ * 
+ * @param max      the current capacity
+ * @param required the capacity needed
+ * 
+ * @return required
+ */
+size_t growth_exact ( size_t max, size_t required );
 
-    // Flush stdio
-    fflush(stdout);
+/** !
+ * Grow an array to the largest capacity there is
+ * 
+ * @param max      the current capacity
+ * @param required the capacity needed
+ * 
+ * @return SIZE_MAX
+ */
+size_t growth_unbounded ( size_t max, size_t required );
+
+/** !
+ * Construct an empty array, shrink it to fit, return the result 
+ * 
+ * @param pp_array []
+ * 
+ * @return void
+ */
+void construct_empty_shrinktofit_empty ( array **pp_array );
+
+/** !
+ * Construct an [A, B, C] array, reserve 16 elements, shrink it to fit, return the result 
+ * 
+ * @param pp_array [A, B, C]
+ * 
+ * @return void
+ */
+void construct_ABC_reserve16shrinktofit_ABC ( array **pp_array );
+
+/** !
+ * Construct an empty sized array with room for one record, add A, B, and C, return the result 
+ * 
+ * @param pp_array [A, B, C]
+ * 
+ * @return void
+ */
+void construct_sized_empty_addABC_ABC ( array **pp_array );
+
+/** !
+ * Construct an empty sized array with room for one record, emplace A, B, and C, return the result 
+ * 
+ * @param pp_array [A, B, C]
+ * 
+ * @return void
+ */
+void construct_sized_empty_emplaceABC_ABC ( array **pp_array );
+
+/** !
+ * Construct a sized [A, B, D] array, set 2 to C, return the result 
+ * 
+ * @param pp_array [A, B, C]
+ * 
+ * @return void
+ */
+void construct_sized_ABD_set2C_ABC ( array **pp_array );
+
+/** !
+ * Construct a sized [D, A, B, C] array, remove 0, return the result 
+ * 
+ * @param pp_array [A, B, C]
+ * 
+ * @return void
+ */
+void construct_sized_DABC_remove0_ABC ( array **pp_array );
+
+/** !
+ * Construct a [C, A, B] array, sort it, return the result 
+ * 
+ * @param pp_array [A, B, C]
+ * 
+ * @return void
+ */
+void construct_CAB_sort_ABC ( array **pp_array );
+
+/** !
+ * Construct a [D, A, D, B, C, D] array, filter out "D", return the result 
+ * 
+ * @param pp_array [A, B, C]
+ * 
+ * @return void
+ */
+void construct_DADBCD_filternotD_ABC ( array **pp_array );
+
+/** !
+ * Construct a [D, D, D] array, map each element to the element of ABC_elements at its index, return the result 
+ * 
+ * @param pp_array [A, B, C]
+ * 
+ * @return void
+ */
+void construct_DDD_mapindex_ABC ( array **pp_array );
+
+/** !
+ * Construct a [D, A, D, B, C, D, A] array, collect a pipeline that filters out "D" and takes 3, return the result 
+ * 
+ * @param pp_array [A, B, C]
+ * 
+ * @return void
+ */
+void construct_DADBCDA_pipelinenotDtake3_ABC ( array **pp_array );
+
+/** !
+ * Construct a sized [C, B, A] array, sort it stably, return the result 
+ * 
+ * @param pp_array [A, B, C]
+ * 
+ * @return void
+ */
+void construct_sized_CBA_sortstable_ABC ( array **pp_array );
+
+/** !
+ * Construct an empty sorted array, add "C", "A" and "B", return the result 
+ * 
+ * @param pp_array [A, B, C]
+ * 
+ * @return void
+ */
+void construct_sorted_empty_addCAB_ABC ( array **pp_array );
+
+/** !
+ * Construct an empty sorted sized array, add C, A and B, return the result 
+ * 
+ * @param pp_array [A, B, C]
+ * 
+ * @return void
+ */
+void construct_sized_sorted_empty_addCAB_ABC ( array **pp_array );
+
+/** !
+ * Copy a record into an emplaced slot
+ * 
+ * @param p_element   the slot
+ * @param p_parameter the record
+ * 
+ * @return 1
+ */
+int emplace_record ( void *const p_element, void *const p_parameter );
+
+/** !
+ * Add the first field of a record to a running sum
+ * 
+ * @param p_value the record
+ * @param i       the index
+ * 
+ * @return 1
+ */
+int sum_record ( const void *const p_value, size_t i );
+
+/** !
+ * Add an element of [0, 1, ..., n - 1] to a running sum
+ * 
+ * @param p_value   pointer to a size_t equal to the index
+ * @param index     the index
+ * @param p_context pointer to the running sum
+ * 
+ * @return 1 if the element matches its index, else 0
+ */
+int sum_index_parallel ( const void *const p_value, size_t index, void *const p_context );
+
+/** !
+ * Count a visit, and fail at index 7
+ * 
+ * @param p_value   the element
+ * @param index     the index
+ * @param p_context pointer to the visit count
+ * 
+ * @return 0 at index 7, else 1
+ */
+int fail_at_7_parallel ( const void *const p_value, size_t index, void *const p_context );
+
+/** !
+ * Sum an array of [0, 1, ..., 999] in parallel
+ * 
+ * @param p_value   the element
+ * @param index     the index
+ * @param p_context the array
+ * 
+ * @return 1 if the sum is correct, else 0
+ */
+int nested_parallel ( const void *const p_value, size_t index, void *const p_context );
+
+/** !
+ * Order two strings
+ * 
+ * @param p_a       the first string
+ * @param p_b       the second string
+ * @param p_context unused
+ * 
+ * @return the result of strcmp
+ */
+int compare_string ( const void *const p_a, const void *const p_b, void *const p_context );
+
+/** !
+ * Order two records by their first field
+ * 
+ * @param p_a       pointer to the first record
+ * @param p_b       pointer to the second record
+ * @param p_context unused
+ * 
+ * @return negative, zero or positive
+ */
+int compare_record ( const void *const p_a, const void *const p_b, void *const p_context );
+
+/** !
+ * Square an element of [0, 1, ..., n - 1]
+ * 
+ * @param p_value   pointer to a size_t
+ * @param index     the index
+ * @param p_result  pointer to the square
+ * @param p_context unused
+ * 
+ * @return 1
+ */
+int square_parallel ( const void *const p_value, size_t index, void *const p_result, void *const p_context );
+
+/** !
+ * Test if an element is even
+ * 
+ * @param p_value   pointer to a size_t
+ * @param index     the index
+ * @param p_context unused
+ * 
+ * @return 1 if the element is even, else 0
+ */
+int is_even_parallel ( const void *const p_value, size_t index, void *const p_context );
+
+/** !
+ * Add an element to a sum
+ * 
+ * @param p_accumulator pointer to the sum
+ * @param p_value       pointer to a size_t
+ * @param index         the index
+ * @param p_context     unused
+ * 
+ * @return 1
+ */
+int sum_parallel ( void *const p_accumulator, const void *const p_value, size_t index, void *const p_context );
+
+/** !
+ * Add a sum to another sum
+ * 
+ * @param p_accumulator pointer to the sum
+ * @param p_other       pointer to the other sum
+ * @param p_context     unused
+ * 
+ * @return 1
+ */
+int combine_sum ( void *const p_accumulator, const void *const p_other, void *const p_context );
+
+/** !
+ * Test if an element is not "D"
+ * 
+ * @param p_value   the string
+ * @param index     the index
+ * @param p_context unused
+ * 
+ * @return 1 if the string is not "D", else 0
+ */
+int is_not_D ( const void *const p_value, size_t index, void *const p_context );
+
+/** !
+ * Map an element to the element of ABC_elements at its index, and fail at index 7
+ * 
+ * @param p_value   the element
+ * @param index     the index
+ * @param p_result  pointer to the result
+ * @param p_context unused
+ * 
+ * @return 0 at index 7, else 1
+ */
+int map_index ( const void *const p_value, size_t index, void *const p_result, void *const p_context );
+
+/** !
+ * Count a visit, and test if an element is even
+ * 
+ * @param p_value   pointer to a size_t
+ * @param index     the index
+ * @param p_context pointer to the visit count
+ * 
+ * @return 1 if the element is even, else 0
+ */
+int is_even_visit ( const void *const p_value, size_t index, void *const p_context );
+
+/** !
+ * Test that an element is the square of its index, and count it
+ * 
+ * @param p_value   pointer to a size_t
+ * @param index     the index
+ * @param p_context pointer to the count
+ * 
+ * @return 1 if the element is the square of its index, else 0
+ */
+int is_square_of_index ( const void *const p_value, size_t index, void *const p_context );
+
+/** !
+ * Construct an [A, B, C] array, remove 2, return the result 
+ * 
+ * @param pp_array [A, B]
+ * 
+ * @return void
+ */
+void construct_ABC_remove2_AB  ( array **pp_array );   
+
+// Entry point
+int main ( int argc, const char* argv[] )
+{
+    
+    // Supress compiler warnings
+    (void) argc;
+    (void) argv;
+
+    // Initialized data
+    timestamp t0 = 0,
+              t1 = 0;
+
+    // Formatting
+    printf(
+        "╭──────────────╮\n"\
+        "│ array tester │\n"\
+        "╰──────────────╯\n\n"
+    );
+    
+    // Start
+    t0 = timer_high_precision();
+
+    // Run tests
+    run_tests();
+
+    // Stop
+    t1 = timer_high_precision();
+
+    // Report the time it took to run the tests
+    log_info("array took ");
+    print_time_pretty ( (double)(t1-t0)/(double)timer_seconds_divisor() );
+    log_info(" to test\n");
+
+    // Flush stdio
+    fflush(stdout);
+
+    // Exit
+    return ( total_passes == total_tests ) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+void run_tests ( void )
+{
+
+    // Initialized data
+    const array_sync  strategies[] = { ARRAY_SYNC_MUTEX, ARRAY_SYNC_RWLOCK, ARRAY_SYNC_SEQLOCK, ARRAY_SYNC_NONE };
+    const char       *names[]      = { "mutex", "rwlock", "seqlock", "none" };
+
+    // Run every scenario with each synchronization strategy
+    for (size_t i = 0; i < sizeof(strategies) / sizeof(*strategies); i++)
+    {
+
+        // Formatting
+        log_info("SYNC: %s\n\n", names[i]);
+
+        // Set the strategy
+        test_sync = strategies[i];
+
+        // Run the scenarios
+        run_scenarios();
+    }
+
+    // Done
+    return;
+}
+
+void run_scenarios ( void )
+{
+
+    // ... -> []
+    test_empty_array(construct_empty, "empty");
+
+    // ... -> from_elements(A) -> [A]
+    test_one_element_array(construct_empty_fromelementsA_A, "empty_fromelementsA_A", (void **)A_elements);
+
+    // ... -> from_elements(A, B) -> [A, B]
+    test_two_element_array(construct_empty_fromelementsAB_AB, "empty_fromelementsAB_AB", (void **)AB_elements);
+
+    // ... -> from_elements(A, B, C) -> [A, B, C]
+    test_three_element_array(construct_empty_fromelementsABC_ABC, "empty_fromelementsABC_ABC", (void **)ABC_elements);
+
+    // ... -> from_arguments(A) -> [A]
+    test_one_element_array(construct_empty_fromargumentsA_A, "empty_fromargumentsA_A", (void **)A_elements);
+
+    // ... -> from_arguments(A, B) -> [A, B]
+    test_two_element_array(construct_empty_fromargumentsAB_AB, "empty_fromargumentsAB_AB", (void **)AB_elements);
+
+    // ... -> from_arguments(A, B, C) -> [A, B, C]
+    test_three_element_array(construct_empty_fromargumentsABC_ABC, "empty_fromargumentsABC_ABC", (void **)ABC_elements);
+    
+    // [A, C] -> insert(1, B) -> [A, B, C]
+    test_three_element_array(construct_AC_insert1B_ABC, "AC_insert1B_ABC", (void **)ABC_elements);
+
+    // [B, C] -> insert(-2, A) -> [A, B, C]
+    test_three_element_array(construct_BC_insertneg2A_ABC, "BC_insert-2A_ABC", (void **)ABC_elements);
+
+    // [A] -> insert_many(1, B, C) -> [A, B, C]
+    test_three_element_array(construct_A_insertmany1BC_ABC, "A_insertmany1BC_ABC", (void **)ABC_elements);
+
+    // [C] -> insert_many(0, A, B) -> [A, B, C]
+    test_three_element_array(construct_C_insertmany0AB_ABC, "C_insertmany0AB_ABC", (void **)ABC_elements);
+
+    // [A, B, C] -> clear() -> []
+    test_empty_array(construct_ABC_clear_empty, "ABC_clear_empty");
+ 
+    // [A, B] -> clear() -> []
+    test_empty_array(construct_AB_clear_empty, "AB_clear_empty");
+
+    // [A] -> clear() -> []
+    test_empty_array(construct_A_clear_empty, "A_clear_empty");
+
+    // [] -> add(A) -> [A]
+    test_one_element_array(construct_empty_addA_A, "empty_addA_A", (void **)A_elements);
+
+    // [A] -> add(B) -> [A, B]
+    test_two_element_array(construct_A_addB_AB, "A_addB_AB", (void **)AB_elements);
+
+    // [A, B] -> add(C) -> [A, B, C]
+    test_three_element_array(construct_AB_addC_ABC, "AB_addC_ABC", (void **)ABC_elements);
+
+    // [] -> add_many(A, B, C) -> [A, B, C]
+    test_three_element_array(construct_empty_addmanyABC_ABC, "empty_addmanyABC_ABC", (void **)ABC_elements);
+
+    // [A] -> add_many(B, C) -> [A, B, C]
+    test_three_element_array(construct_A_addmanyBC_ABC, "A_addmanyBC_ABC", (void **)ABC_elements);
+
+    // [A] -> remove(0) -> []
+    test_empty_array(construct_A_remove0_empty, "A_remove0_empty");
+
+    // [A, B] -> remove(1) -> [A]
+    test_one_element_array(construct_AB_remove1_A, "AB_remove1_A", (void **)A_elements);
+
+    // [A, B, C] -> remove(2) -> [A, B]
+    test_two_element_array(construct_ABC_remove2_AB, "ABC_remove2_AB", (void **)AB_elements);
+
+    // [A, B, C] -> remove_unordered(0) -> [C, B]
+    test_two_element_array(construct_ABC_removeunordered0_CB, "ABC_removeunordered0_CB", (void **)CB_elements);
+
+    // [A, B, C] -> remove_unordered(1) -> [A, C]
+    test_two_element_array(construct_ABC_removeunordered1_AC, "ABC_removeunordered1_AC", (void **)AC_elements);
+
+    // [A, B, C] -> remove_unordered_many(0, 2) -> [B]
+    test_one_element_array(construct_ABC_removeunorderedmany02_B, "ABC_removeunorderedmany02_B", (void **)B_elements);
+    print_test("ABC_removeunorderedmany_invalid_ABC", "array_remove_unordered_many", test_remove_unordered_many_invalid(match));
+
+    // [A, B, C] -> remove_range(0, 1) -> [C]
+    test_one_element_array(construct_ABC_removerange01_C, "ABC_removerange01_C", (void **)C_elements);
+
+    // [A, B, C] -> remove_range(1, 2) -> [A]
+    test_one_element_array(construct_ABC_removerange12_A, "ABC_removerange12_A", (void **)A_elements);
+
+    // [A, B, C] -> remove_range(0, 2) -> []
+    test_empty_array(construct_ABC_removerange02_empty, "ABC_removerange02_empty");
+
+    // [A, B, C] -> add(D) x 10 -> remove_range(3, 12) -> [A, B, C]
+    test_three_element_array(construct_ABC_add10Dremoverange312_ABC, "ABC_add10Dremoverange312_ABC", (void **)ABC_elements);
+
+    // inline [] -> add(A) -> add(B) -> add(C) -> [A, B, C]
+    test_three_element_array(construct_inline_empty_addABC_ABC, "inline_empty_addABC_ABC", (void **)ABC_elements);
+    print_test("inline_empty_addABC_ABC", "array_capacity", test_capacity(construct_inline_empty_addABC_ABC, 3, match));
+
+    // inline [] -> add(A) -> add(B) -> add(C) -> [A, B, C], past the inline storage
+    test_three_element_array(construct_inline1_empty_addABC_ABC, "inline1_empty_addABC_ABC", (void **)ABC_elements);
+
+    // allocator [] -> add(A) -> add(B) -> add(C) -> reserve(16) -> [A, B, C]
+    test_three_element_array(construct_allocator_empty_addABCreserve16_ABC, "allocator_empty_addABCreserve16_ABC", (void **)ABC_elements);
+    print_test("allocator_empty_addABCreserve16_ABC", "allocator_used", allocations[0] > 0);
+    print_test("allocator_empty_addABCreserve16_ABC", "allocator_balanced", allocations[1] == 0);
+    print_test("allocator", "array_construct_no_mem", test_construct_no_mem(match));
+
+    // arena [] -> add(A) -> add(B) -> add(C) -> add(D) x 10 -> remove_range(3, 12) -> [A, B, C]
+    array_arena_construct(&p_test_arena, 256);
+    test_three_element_array(construct_arena_empty_addABC10Dremoverange312_ABC, "arena_empty_addABC10Dremoverange312_ABC", (void **)ABC_elements);
+    array_arena_destroy(&p_test_arena);
+
+    // Arena growth and reset
+    print_test("arena", "array_arena_grow_in_place", test_arena_grow_in_place(match));
+    print_test("arena", "array_arena_reset", test_arena_reset(match));
+
+    // pool [D x 10] -> release -> [] -> add(A) -> add(B) -> add(C) -> [A, B, C]
+    array_pool_construct(&p_test_pool, 4);
+    test_three_element_array(construct_pool_10Dreleased_addABC_ABC, "pool_10Dreleased_addABC_ABC", (void **)ABC_elements);
+    array_pool_destroy(&p_test_pool);
+
+    // Pool reuse
+    print_test("pool", "array_pool_reuse", test_pool_reuse(match));
+    print_test("pool", "array_pool_mismatch", test_pool_mismatch(match));
+
+    // Parallel iteration
+    print_test("parallel", "array_foreach_parallel_one_grain", test_foreach_parallel(100, 0, match));
+    print_test("parallel", "array_foreach_parallel", test_foreach_parallel(100000, 64, match));
+    print_test("parallel", "array_foreach_parallel_error", test_foreach_parallel_error(match));
+    print_test("parallel", "array_foreach_parallel_nested", test_foreach_parallel_nested(match));
+
+    // [] -> reserve(16) -> []
+    test_empty_array(construct_empty_reserve16_empty, "empty_reserve16_empty");
+    print_test("empty_reserve16_empty", "array_capacity", test_capacity(construct_empty_reserve16_empty, 16, match));
+
+    // [] -> growth(half) -> add_many(A, B, C) -> [A, B, C]
+    test_three_element_array(construct_empty_growthhalfaddABC_ABC, "empty_growthhalfaddABC_ABC", (void **)ABC_elements);
+    print_test("empty_growthhalfaddABC_ABC", "array_capacity", test_capacity(construct_empty_growthhalfaddABC_ABC, 3, match));
+
+    // [] -> growth(fixed, 5) -> add_many(A, B, C) -> [A, B, C]
+    test_three_element_array(construct_empty_growthfixed5addABC_ABC, "empty_growthfixed5addABC_ABC", (void **)ABC_elements);
+    print_test("empty_growthfixed5addABC_ABC", "array_capacity", test_capacity(construct_empty_growthfixed5addABC_ABC, 7, match));
+
+    // [] -> growth(callback) -> add_many(A, B, C) -> [A, B, C]
+    test_three_element_array(construct_empty_growthcallbackaddABC_ABC, "empty_growthcallbackaddABC_ABC", (void **)ABC_elements);
+    print_test("empty_growthcallbackaddABC_ABC", "array_capacity", test_capacity(construct_empty_growthcallbackaddABC_ABC, 3, match));
+
+    // [] -> growth(usable size) -> add(A) -> add(B) -> add(C) -> [A, B, C]
+    test_three_element_array(construct_empty_growthusableaddABC_ABC, "empty_growthusableaddABC_ABC", (void **)ABC_elements);
+
+    // [A, B, C] -> shrink_policy(0.25, 2) -> remove(2) -> [A, B]
+    test_two_element_array(construct_ABC_shrinkpolicyremove2_AB, "ABC_shrinkpolicyremove2_AB", (void **)AB_elements);
+    print_test("ABC_shrinkpolicyremove2_AB", "array_capacity", test_capacity(construct_ABC_shrinkpolicyremove2_AB, ( test_sync == ARRAY_SYNC_SEQLOCK ) ? 16 : 4, match));
+
+    // [A, B, C] -> shrink_policy(0.25, 2) -> clear() -> []
+    test_empty_array(construct_ABC_shrinkpolicyclear_empty, "ABC_shrinkpolicyclear_empty");
+    print_test("ABC_shrinkpolicyclear_empty", "array_capacity", test_capacity(construct_ABC_shrinkpolicyclear_empty, ( test_sync == ARRAY_SYNC_SEQLOCK ) ? 16 : 2, match));
+
+    // [] -> sized add(A) -> add(B) -> add(C) -> [A, B, C]
+    test_sized_three_element_array(construct_sized_empty_addABC_ABC, "sized_empty_addABC_ABC", ABC_records);
+
+    // [] -> sized emplace(A) -> emplace(B) -> emplace(C) -> [A, B, C]
+    test_sized_three_element_array(construct_sized_empty_emplaceABC_ABC, "sized_empty_emplaceABC_ABC", ABC_records);
+
+    // [A, B, D] -> sized set(2, C) -> [A, B, C]
+    test_sized_three_element_array(construct_sized_ABD_set2C_ABC, "sized_ABD_set2C_ABC", ABC_records);
+
+    // [D, A, B, C] -> sized remove(0) -> [A, B, C]
+    test_sized_three_element_array(construct_sized_DABC_remove0_ABC, "sized_DABC_remove0_ABC", ABC_records);
+
+    // [C, B, A] -> sized sort_stable() -> [A, B, C]
+    test_sized_three_element_array(construct_sized_CBA_sortstable_ABC, "sized_CBA_sortstable_ABC", ABC_records);
+
+    // [C, A, B] -> sort() -> [A, B, C]
+    test_three_element_array(construct_CAB_sort_ABC, "CAB_sort_ABC", (void **)ABC_elements);
+
+    // [D, A, D, B, C, D] -> filter(not D) -> [A, B, C]
+    test_three_element_array(construct_DADBCD_filternotD_ABC, "DADBCD_filternotD_ABC", (void **)ABC_elements);
+
+    // [D, D, D] -> map(index) -> [A, B, C]
+    test_three_element_array(construct_DDD_mapindex_ABC, "DDD_mapindex_ABC", (void **)ABC_elements);
+
+    // Transforms
+    print_test("transform", "array_transform_empty", test_transform(0, 0, match));
+    print_test("transform", "array_transform_one_grain", test_transform(100, 0, match));
+    print_test("transform", "array_transform", test_transform(100000, 64, match));
+    print_test("transform", "array_transform_uneven", test_transform(1001, 10, match));
+    print_test("transform", "array_transform_error", test_transform_error(match));
+
+    // [D, A, D, B, C, D, A] -> pipeline(filter(not D), take(3)) -> collect -> [A, B, C]
+    test_three_element_array(construct_DADBCDA_pipelinenotDtake3_ABC, "DADBCDA_pipelinenotDtake3_ABC", (void **)ABC_elements);
+
+    // Pipelines
+    print_test("pipeline", "array_pipeline_short", test_pipeline(15, match));
+    print_test("pipeline", "array_pipeline", test_pipeline(100000, match));
+    print_test("pipeline", "array_pipeline_empty", test_pipeline_empty(match));
+
+    // Functions for arrays of pointers
+    print_test("sized", "array_pointer_functions_sized", test_pointer_functions_sized(match));
+
+    // Capacities that overflow
+    print_test("capacity", "array_reserve_overflow", test_reserve_overflow(match));
+    print_test("capacity", "array_growth_overflow", test_growth_overflow(match));
+
+    // Storage replaced by sequence locked arrays
+    print_test("seqlock", "array_seqlock_retired", test_seqlock_retired(match));
+
+    // sorted [] -> add(C) -> add(A) -> add(B) -> [A, B, C]
+    test_three_element_array(construct_sorted_empty_addCAB_ABC, "sorted_empty_addCAB_ABC", (void **)ABC_elements);
+
+    // sorted [] -> sized add(C) -> add(A) -> add(B) -> [A, B, C]
+    test_sized_three_element_array(construct_sized_sorted_empty_addCAB_ABC, "sized_sorted_empty_addCAB_ABC", ABC_records);
+
+    // Sorted arrays
+    print_test("sorted", "array_lower_bound_empty", test_sorted_search(0, 1, false, match));
+    print_test("sorted", "array_lower_bound_1", test_sorted_search(1, 1, false, match));
+    print_test("sorted", "array_lower_bound_duplicates", test_sorted_search(500, 20, false, match));
+    print_test("sorted", "array_lower_bound_1000", test_sorted_search(1000, 4000, false, match));
+    print_test("sorted", "array_freeze_empty", test_sorted_search(0, 1, true, match));
+    print_test("sorted", "array_freeze_1", test_sorted_search(1, 1, true, match));
+    print_test("sorted", "array_freeze_255", test_sorted_search(255, 1000, true, match));
+    print_test("sorted", "array_freeze_duplicates", test_sorted_search(500, 20, true, match));
+    print_test("sorted", "array_freeze_1000", test_sorted_search(1000, 4000, true, match));
+    print_test("sorted", "array_sorted_reorder", test_sorted_reorder(match));
+
+    // Sorting
+    print_test("sort", "array_sized_sort_1000", test_sort(1000, 1000, false, match));
+    print_test("sort", "array_sized_sort_duplicates", test_sort(1000, 3, false, match));
+    print_test("sort", "array_sized_sort_parallel", test_sort(200000, 50000, false, match));
+    print_test("sort", "array_sized_sort_stable_1000", test_sort(1000, 7, true, match));
+    print_test("sort", "array_sized_sort_stable_parallel", test_sort(200000, 1000, true, match));
+
+    // [] -> shrink_to_fit() -> []
+    test_empty_array(construct_empty_shrinktofit_empty, "empty_shrinktofit_empty");
+    print_test("empty_shrinktofit_empty", "array_capacity", test_capacity(construct_empty_shrinktofit_empty, 1, match));
+
+    // [A, B, C] -> reserve(16) -> shrink_to_fit() -> [A, B, C]
+    test_three_element_array(construct_ABC_reserve16shrinktofit_ABC, "ABC_reserve16shrinktofit_ABC", (void **)ABC_elements);
+    print_test("ABC_reserve16shrinktofit_ABC", "array_capacity", test_capacity(construct_ABC_reserve16shrinktofit_ABC, ( test_sync == ARRAY_SYNC_SEQLOCK ) ? 16 : 3, match));
+
+    // Done
+    return;
+}
+
+void print_final_summary ( void )
+{
+
+    // Accumulate
+    total_tests  += ephemeral_tests,
+    total_passes += ephemeral_passes,
+    total_fails  += ephemeral_fails;
+
+    // Print
+    log_info("\nTests: %d, Passed: %d, Failed: %d (%%%.3f)\n",  ephemeral_tests, ephemeral_passes, ephemeral_fails, ((float)ephemeral_passes/(float)ephemeral_tests*100.f));
+    log_info("Total: %d, Passed: %d, Failed: %d (%%%.3f)\n\n",  total_tests, total_passes, total_fails, ((float)total_passes/(float)total_tests*100.f));
+    
+    // Clear test counters for this test
+    ephemeral_tests  = 0;
+    ephemeral_passes = 0;
+    ephemeral_fails  = 0;
+
+    // Done
+    return;
+}
+
+void print_test ( const char *scenario_name, const char *test_name, bool passed )
+{
+
+    // Initialized data
+    if ( passed )
+        log_pass("%s %s\n", scenario_name, test_name);
+    else
+        log_fail("%s %s\n", scenario_name, test_name);
+
+
+    // Increment the pass/fail counter
+    if (passed)
+        ephemeral_passes++;
+    else
+        ephemeral_fails++;
+
+    // Increment the test counter
+    ephemeral_tests++;
+
+    // Done
+    return;
+}
+
+bool test_add ( void(*array_constructor)(array **pp_array), void *value, result_t expected )
+{
+
+    // Initialized data
+    result_t  result = 0;
+    array     *p_array = 0;
+
+    // Build the array
+    array_constructor(&p_array);
+
+    // Add an element
+    result = (result_t) array_add(p_array, value);
+
+    // Free the array
+    array_destroy(&p_array);
+
+    // Return result
+    return (result == expected);
+}
+
+bool test_remove ( void(*array_constructor)(array **pp_array), void *value, signed index, result_t expected )
+{
+
+    // Initialized data
+    result_t  result  = 0;
+    array    *p_array = 0;
+    void     *p_ret   = (void*) -1;
+
+    // Build the array
+    array_constructor(&p_array);
+
+    // Remove an element
+    result = (result_t) array_remove(p_array, index, &p_ret);
+    
+    // Check for a match
+    result = ( value == p_ret ) ? match : result;
+
+    // Free the array
+    array_destroy(&p_array);
+
+    // Return result
+    return (result == expected);
+}
+
+bool test_get ( void(*array_constructor)(array **pp_array), void **expected_values, result_t expected )
+{
+
+    // Initialized data
+    result_t  result       = 0;
+    array    *p_array      = 0;
+    void     *result_value = 0;
+
+    // Build the array
+    array_constructor(&p_array);
+
+    // Get a key 
+    //result_value = array_get(p_array, key);
+
+    result = (result_value == expected_values) ? match : zero;
+
+    // Free the array
+    array_destroy(&p_array);
+
+    // Return result
+    return (result == expected);
+}
+
+bool test_get_count ( void(*array_constructor)(array **pp_array), size_t expected_size, result_t expected )
+{
+
+    // Initialized data
+    result_t  result       = 0;
+    array    *p_array      = 0;
+    size_t    result_value = 0;
+
+    // Build the array
+    array_constructor(&p_array);
+
+    // Get the size of the array
+    array_get(p_array, 0, &result_value);
+
+    // 
+    result = (result_value == expected_size) ? match : zero;
+
+    // Free the array
+    array_destroy(&p_array);
+
+    // Return result
+    return (result == expected);
+}
+
+bool test_view ( void(*array_constructor)(array **pp_array), void **expected_values, size_t expected_size, result_t expected )
+{
+
+    // Initialized data
+    result_t            result      = 0;
+    array              *p_array     = 0;
+    const void *const  *pp_elements = 0;
+    size_t              count       = 0;
+
+    // Build the array
+    array_constructor(&p_array);
+
+    // Borrow the elements
+    result = (result_t) array_view_acquire(p_array, &pp_elements, &count);
+
+    // Error check
+    if ( result == zero ) goto done;
+
+    // Test is successful if ...
+    result = ( count == expected_size ) ? match : zero;
+
+    // ... each element in the view ...
+    for (size_t i = 0; i < count && result == match; i++)
+
+        // ... matches each expected value ...
+        if ( pp_elements[i] != expected_values[i] )
+
+            // ... else the test failed
+            result = zero;
+
+    // Release the view
+    array_view_release(p_array);
+
+    done:
+
+    // Free the array
+    array_destroy(&p_array);
+
+    // Return result
+    return (result == expected);
+}
+
+bool test_sized_index ( void(*array_constructor)(array **pp_array), signed idx, const record *expected_value, result_t expected )
+{
+
+    // Initialized data
+    result_t  result       = 0;
+    array    *p_array      = 0;
+    record    result_value = { 0 };
+
+    // Build the array
+    array_constructor(&p_array);
+
+    // Index the array
+    result = (result_t) array_sized_index(p_array, idx, &result_value);
+    
+    if ( result == 1 )
+        if ( memcmp(&result_value, expected_value, sizeof(record)) == 0 )
+            result = match;
+
+    // Free the array
+    array_destroy(&p_array);
+
+    // Return result
+    return (result == expected);
+}
+
+bool test_sized_remove ( void(*array_constructor)(array **pp_array), signed idx, const record *expected_value, result_t expected )
+{
+
+    // Initialized data
+    result_t  result       = 0;
+    array    *p_array      = 0;
+    record    result_value = { 0 };
+
+    // Build the array
+    array_constructor(&p_array);
+
+    // Remove the record
+    result = (result_t) array_sized_remove(p_array, idx, &result_value);
+    
+    if ( result == 1 )
+        if ( memcmp(&result_value, expected_value, sizeof(record)) == 0 )
+            result = match;
+
+    // Free the array
+    array_destroy(&p_array);
+
+    // Return result
+    return (result == expected);
+}
+
+bool test_sized_foreach_i ( void(*array_constructor)(array **pp_array), long long expected_sum, result_t expected )
+{
+
+    // Initialized data
+    result_t  result  = 0;
+    array    *p_array = 0;
+
+    // Build the array
+    array_constructor(&p_array);
+
+    // Sum the first field of each record
+    record_sum = 0;
+    result     = (result_t) array_sized_foreach_i(p_array, sum_record);
+
+    if ( result == 1 )
+        if ( record_sum == expected_sum )
+            result = match;
+
+    // Free the array
+    array_destroy(&p_array);
+
+    // Return result
+    return (result == expected);
+}
+
+bool test_arena_grow_in_place ( result_t expected )
+{
+
+    // Initialized data
+    result_t            result    = zero;
+    array_arena        *p_arena   = 0;
+    array              *p_array   = 0;
+    const void *const  *p_before  = 0;
+    const void *const  *p_after   = 0;
+
+    // Construct an array in an arena
+    if ( array_arena_construct(&p_arena, 4096) == 0 ) goto done;
+    if ( array_arena_array(p_arena, &p_array, 1, sizeof(void *)) == 0 ) goto done;
+
+    // Spill the array out of its inline storage
+    for (size_t i = 0; i < 16; i++) array_add(p_array, D_element);
+    array_view_acquire(p_array, &p_before, (void *) 0);
+    array_view_release(p_array);
+
+    // Grow the array
+    for (size_t i = 0; i < 64; i++) array_add(p_array, D_element);
+    array_view_acquire(p_array, &p_after, (void *) 0);
+    array_view_release(p_array);
+
+    // The storage did not move
+    result = ( p_before == p_after && array_size(p_array) == 80 ) ? match : zero;
+
+    done:
+
+    // Release the arena
+    array_arena_destroy(&p_arena);
+
+    // Return result
+    return (result == expected);
+}
+
+bool test_arena_reset ( result_t expected )
+{
+
+    // Initialized data
+    result_t     result   = zero;
+    array_arena *p_arena  = 0;
+    array       *p_first  = 0,
+                *p_second = 0,
+                *p_array  = 0;
+
+    // Construct some arrays in an arena
+    if ( array_arena_construct(&p_arena, 256) == 0 ) goto done;
+    if ( array_arena_array(p_arena, &p_first, 1, sizeof(void *)) == 0 ) goto done;
+    for (size_t i = 0; i < 32; i++) array_arena_array(p_arena, &p_array, 4, sizeof(void *));
+
+    // Release every array at once
+    array_arena_reset(p_arena);
+
+    // The next array reuses the memory of the first
+    if ( array_arena_array(p_arena, &p_second, 1, sizeof(void *)) == 0 ) goto done;
+    result = ( p_first == p_second ) ? match : zero;
+
+    done:
+
+    // Release the arena
+    array_arena_destroy(&p_arena);
+
+    // Return result
+    return (result == expected);
+}
+
+bool test_pool_reuse ( result_t expected )
+{
+
+    // Initialized data
+    result_t    result   = zero;
+    array_pool *p_pool   = 0;
+    array      *p_first  = 0,
+               *p_second = 0,
+               *p_array  = 0;
+    size_t      hits     = 0,
+                misses   = 0;
+
+    // Construct an array from a pool, and fill it
+    if ( array_pool_construct(&p_pool, 2) == 0 ) goto done;
+    if ( array_pool_array(p_pool, &p_first, 1, sizeof(void *), ARRAY_SYNC_MUTEX) == 0 ) goto done;
+    for (size_t i = 0; i < 32; i++) array_add(p_first, D_element);
+
+    // Release it
+    p_array = p_first;
+    if ( array_pool_release(p_pool, &p_array) == 0 ) goto done;
+
+    // The next array is the released array, emptied
+    if ( array_pool_array(p_pool, &p_second, 4, sizeof(record), ARRAY_SYNC_MUTEX) == 0 ) goto done;
+    array_pool_stats(p_pool, &hits, &misses);
+    result = ( p_first == p_second && array_size(p_second) == 0 && array_capacity(p_second) >= 4 && hits == 1 && misses == 1 ) ? match : zero;
+
+    // Release the array
+    array_pool_release(p_pool, &p_second);
+
+    done:
+
+    // Destroy the pool
+    array_pool_destroy(&p_pool);
+
+    // Return result
+    return (result == expected);
+}
+
+bool test_pool_mismatch ( result_t expected )
+{
+
+    // Initialized data
+    result_t    result   = zero;
+    array_pool *p_pool   = 0;
+    array      *p_first  = 0,
+               *p_second = 0,
+               *p_third  = 0;
+    size_t      hits     = 0,
+                misses   = 0;
+
+    // Construct two arrays from a pool with room for one
+    if ( array_pool_construct(&p_pool, 1) == 0 ) goto done;
+    if ( array_pool_array(p_pool, &p_first, 1, sizeof(void *), ARRAY_SYNC_MUTEX) == 0 ) goto done;
+    if ( array_pool_array(p_pool, &p_second, 1, sizeof(void *), ARRAY_SYNC_RWLOCK) == 0 ) goto done;
+
+    // The second release does not fit, so it destroys the array
+    array_pool_release(p_pool, &p_first);
+    array_pool_release(p_pool, &p_second);
+
+    // A read write locked array can not reuse the mutex array
+    if ( array_pool_array(p_pool, &p_third, 1, sizeof(void *), ARRAY_SYNC_RWLOCK) == 0 ) goto done;
+    array_pool_stats(p_pool, &hits, &misses);
+    result = ( p_first == (void *) 0 && p_second == (void *) 0 && hits == 0 && misses == 3 ) ? match : zero;
+
+    // Destroy the array
+    array_destroy(&p_third);
+
+    done:
+
+    // Destroy the pool
+    array_pool_destroy(&p_pool);
+
+    // Return result
+    return (result == expected);
+}
+
+bool test_foreach_parallel ( size_t count, size_t grain, result_t expected )
+{
+
+    // Initialized data
+    result_t  result  = zero;
+    array    *p_array = 0;
+    size_t    sum     = 0;
+
+    // [] -> add(0) -> add(1) -> ... -> add(count - 1)
+    if ( array_construct_sized_sync(&p_array, 1, sizeof(size_t), ARRAY_SYNC_RWLOCK) == 0 ) goto done;
+    for (size_t i = 0; i < count; i++) array_sized_add(p_array, &i);
+
+    // Sum the elements
+    if ( array_sized_foreach_parallel(p_array, sum_index_parallel, &sum, grain) == 0 ) goto done;
+
+    // Every element was visited once
+    result = ( sum == count * ( count - 1 ) / 2 ) ? match : zero;
+
+    done:
+
+    // Destroy the array
+    array_destroy(&p_array);
+
+    // Return result
+    return (result == expected);
+}
+
+bool test_foreach_parallel_error ( result_t expected )
+{
+
+    // Initialized data
+    result_t  result  = zero;
+    array    *p_array = 0;
+    size_t    visits  = 0;
+    int       status  = 0;
+
+    // [] -> add(D) x 1000
+    if ( array_construct(&p_array, 1) == 0 ) goto done;
+    for (size_t i = 0; i < 1000; i++) array_add(p_array, D_element);
+
+    // Fail at index 7
+    status = array_foreach_parallel(p_array, fail_at_7_parallel, &visits, 8);
+
+    // The failure is reported, and every element was still visited
+    result = ( status == 0 && visits == 1000 ) ? match : zero;
+
+    done:
+
+    // Destroy the array
+    array_destroy(&p_array);
+
+    // Return result
+    return (result == expected);
+}
+
+bool test_foreach_parallel_nested ( result_t expected )
+{
+
+    // Initialized data
+    result_t  result  = zero;
+    array    *p_outer = 0,
+             *p_inner = 0;
+
+    // [] -> add(0) -> add(1) -> ... -> add(999)
+    if ( array_construct_sized(&p_inner, 1, sizeof(size_t)) == 0 ) goto done;
+    for (size_t i = 0; i < 1000; i++) array_sized_add(p_inner, &i);
+
+    // [] -> add(D) x 64
+    if ( array_construct(&p_outer, 1) == 0 ) goto done;
+    for (size_t i = 0; i < 64; i++) array_add(p_outer, D_element);
+
+    // Sum the inner array from each element of the outer array
+    result = ( array_foreach_parallel(p_outer, nested_parallel, p_inner, 1) == 1 ) ? match : zero;
+
+    done:
+
+    // Destroy the arrays
+    array_destroy(&p_outer);
+    array_destroy(&p_inner);
+
+    // Return result
+    return (result == expected);
+}
+
+bool test_sort ( size_t count, size_t keys, bool stable, result_t expected )
+{
+
+    // Initialized data
+    result_t  result  = zero;
+    array    *p_array = 0;
+    record    _record = { 0 },
+              _last   = { 0 };
+    long long sum     = 0;
+    size_t    seed    = 1;
+
+    // Add records with pseudo random first fields, numbered in order
+    if ( array_construct_sized(&p_array, count, sizeof(record)) == 0 ) goto done;
+    for (size_t i = 0; i < count; i++)
+    {
+        seed      = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        _record.a = (long long) ( ( seed >> 33 ) % keys ),
+        _record.b = (long long) i;
+        sum      += _record.a;
+        array_sized_add(p_array, &_record);
+    }
+
+    // Sort
+    if ( ( stable ? array_sized_sort_stable : array_sized_sort )(p_array, compare_record, (void *) 0) == 0 ) goto done;
+
+    // Check the order
+    result = match;
+    for (size_t i = 0; i < count; i++)
+    {
+
+        // Get the record
+        array_sized_index(p_array, (signed) i, &_record);
+        sum -= _record.a;
+
+        // Out of order
+        if ( i && _record.a < _last.a ) result = zero;
+
+        // Equal records out of order
+        if ( i && stable && _record.a == _last.a && _record.b < _last.b ) result = zero;
+
+        // Next
+        _last = _record;
+    }
+
+    // The records are the ones that were added
+    if ( sum ) result = zero;
+
+    done:
+
+    // Destroy the array
+    array_destroy(&p_array);
+
+    // Return result
+    return (result == expected);
+}
+
+bool test_sorted_search ( size_t count, size_t keys, bool frozen, result_t expected )
+{
+
+    // Initialized data
+    result_t  result  = zero;
+    array    *p_array = 0;
+    record    _record = { 0 },
+              _last   = { 0 };
+    size_t    seed    = 1;
+
+    // Add records with pseudo random first fields
+    if ( array_construct_sized_sorted(&p_array, 1, sizeof(record), test_sync, compare_record, (void *) 0) == 0 ) goto done;
+    for (size_t i = 0; i < count; i++)
+    {
+        seed      = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        _record.a = (long long) ( ( seed >> 33 ) % keys );
+        array_sized_add(p_array, &_record);
+    }
+
+    // The records are in order
+    result = match;
+    for (size_t i = 1; i < count; i++)
+    {
+        array_sized_index(p_array, (signed) i - 1, &_last);
+        array_sized_index(p_array, (signed) i, &_record);
+        if ( _record.a < _last.a ) result = zero;
+    }
+
+    // Freeze the array
+    if ( frozen && array_freeze(p_array) == 0 ) result = zero;
+
+    // Search for every key
+    if ( check_sorted_search(p_array, keys) == false ) result = zero;
+
+    // A write leaves the frozen layout stale, and searches still agree with the scan
+    if ( frozen )
+    {
+        _record.a = (long long) keys / 2;
+        array_sized_add(p_array, &_record);
+        if ( check_sorted_search(p_array, keys) == false ) result = zero;
+    }
+
+    done:
+
+    // Destroy the array
+    array_destroy(&p_array);
+
+    // Return result
+    return (result == expected);
+}
+
+bool check_sorted_search ( array *p_array, size_t keys )
+{
+
+    // Initialized data
+    size_t count = array_size(p_array);
+    record _record = { 0 };
+
+    // Search for every key, and one past each end
+    for (long long key = -1; key <= (long long) keys; key++)
+    {
+
+        // Initialized data
+        record _key   = { .a = key };
+        size_t index  = 0,
+               found  = 0,
+               linear = 0;
+
+        // Find the first record that is not less than the key, by scanning
+        for (linear = 0; linear < count; linear++)
+        {
+            array_sized_index(p_array, (signed) linear, &_record);
+            if ( _record.a >= key ) break;
+        }
+
+        // The lower bound matches the scan
+        if ( array_lower_bound(p_array, &_key, &index) == 0 || index != linear ) return false;
+
+        // A record is found if, and only if, the scan stopped on an equal record
+        if ( (bool) array_find_sorted(p_array, &_key, &found) != ( linear < count && _record.a == key ) ) return false;
+        if ( linear < count && _record.a == key && found != linear ) return false;
+    }
+
+    // Success
+    return true;
+}
+
+bool test_sorted_reorder ( result_t expected )
+{
+
+    // Initialized data
+    result_t  result  = zero;
+    array    *p_array = 0,
+             *p_sized = 0;
+
+    // Construct sorted arrays
+    if ( array_construct_sorted(&p_array, 4, test_sync, compare_string, (void *) 0) == 0 ) goto done;
+    if ( array_construct_sized_sorted(&p_sized, 4, sizeof(record), test_sync, compare_record, (void *) 0) == 0 ) goto done;
+    array_add(p_array, B_element);
+    array_add(p_array, A_element);
+    array_sized_add(p_sized, &B_record);
+    array_sized_add(p_sized, &A_record);
+
+    // Every reordering fails
+    result = match;
+    if ( array_insert(p_array, 0, C_element)                              ) result = zero;
+    if ( array_set(p_array, 0, C_element)                                 ) result = zero;
+    if ( array_remove_unordered(p_array, 0, (void *) 0)                   ) result = zero;
+    if ( array_sort(p_array, compare_string, (void *) 0)                  ) result = zero;
+    if ( array_sized_set(p_sized, 0, &C_record)                           ) result = zero;
+    if ( array_sized_emplace(p_sized, emplace_record, (void *) &C_record) ) result = zero;
+
+    // Nothing changed
+    if ( array_size(p_array) != 2 || array_size(p_sized) != 2 ) result = zero;
+
+    done:
+
+    // Destroy the arrays
+    array_destroy(&p_array);
+    array_destroy(&p_sized);
+
+    // Return result
+    return (result == expected);
+}
+
+bool test_transform ( size_t count, size_t grain, result_t expected )
+{
+
+    // Initialized data
+    result_t  result     = zero;
+    array    *p_array    = 0,
+             *p_squares  = 0,
+             *p_evens    = 0;
+    size_t    sum        = 0,
+              expect_sum = 0,
+              square     = 0;
+
+    // [] -> add(0) -> add(1) -> ... -> add(count - 1)
+    if ( array_construct_sized_sync(&p_array, 1, sizeof(size_t), ARRAY_SYNC_RWLOCK) == 0 ) goto done;
+    for (size_t i = 0; i < count; i++) array_sized_add(p_array, &i);
+
+    // [0, 1, 4, ...] -> [0, 4, 16, ...] -> sum
+    if ( array_sized_map(p_array, &p_squares, sizeof(size_t), square_parallel, (void *) 0, grain) == 0 ) goto done;
+    if ( array_sized_filter(p_squares, &p_evens, is_even_parallel, (void *) 0, grain) == 0 ) goto done;
+    if ( array_sized_reduce(p_evens, &sum, sizeof(size_t), sum_parallel, combine_sum, (void *) 0, grain) == 0 ) goto done;
+
+    // Each output is sized exactly
+    if ( array_size(p_squares) != count || array_capacity(p_squares) != ( ( count ) ? count : 1 ) ) goto done;
+    if ( array_size(p_evens) != ( count + 1 ) / 2 || array_capacity(p_evens) != ( ( count ) ? ( count + 1 ) / 2 : 1 ) ) goto done;
+
+    // The even squares are in order
+    for (size_t i = 0; i < array_size(p_evens); i++)
+    {
+
+        // Get the square
+        array_sized_index(p_evens, (signed) i, &square);
+
+        // Check it
+        if ( square != 4 * i * i ) goto done;
+
+        // Sum it
+        expect_sum += square;
+    }
+
+    // The sum matches
+    result = ( sum == expect_sum ) ? match : zero;
+
+    done:
+
+    // Destroy the arrays
+    array_destroy(&p_array);
+    if ( p_squares ) array_destroy(&p_squares);
+    if ( p_evens   ) array_destroy(&p_evens);
+
+    // Return result
+    return (result == expected);
+}
+
+bool test_transform_error ( result_t expected )
+{
+
+    // Initialized data
+    result_t  result   = zero;
+    array    *p_array  = 0,
+             *p_result = 0;
+
+    // [] -> add(D) x 1000
+    if ( array_construct(&p_array, 1) == 0 ) goto done;
+    for (size_t i = 0; i < 1000; i++) array_add(p_array, D_element);
+
+    // Fail at index 7
+    result = ( array_map(p_array, &p_result, map_index, (void *) 0, 8) == 0 && p_result == (void *) 0 ) ? match : zero;
+
+    done:
+
+    // Destroy the arrays
+    array_destroy(&p_array);
+    if ( p_result ) array_destroy(&p_result);
+
+    // Return result
+    return (result == expected);
+}
+
+bool test_pipeline ( size_t count, result_t expected )
+{
+
+    // Initialized data
+    result_t        result     = zero;
+    array          *p_array    = 0,
+                   *p_result   = 0;
+    array_pipeline *p_pipeline = 0;
+    size_t          visits     = 0,
+                    taken      = ( ( count + 1 ) / 2 < 10 ) ? ( count + 1 ) / 2 : 10,
+                    size       = 0,
+                    sum        = 0,
+                    expect_sum = 0,
+                    first      = 1,
+                    square     = 0,
+                    checked    = 0;
+
+    // [] -> add(0) -> add(1) -> ... -> add(count - 1)
+    if ( array_construct_sized_sync(&p_array, 1, sizeof(size_t), ARRAY_SYNC_RWLOCK) == 0 ) goto done;
+    for (size_t i = 0; i < count; i++) array_sized_add(p_array, &i);
+
+    // filter(even) -> map(square) -> take(10)
+    if ( array_pipeline_construct_sized(&p_pipeline, p_array) == 0 ) goto done;
+    if ( array_pipeline_filter(p_pipeline, is_even_visit, &visits) == 0 ) goto done;
+    if ( array_pipeline_sized_map(p_pipeline, sizeof(size_t), square_parallel, (void *) 0) == 0 ) goto done;
+    if ( array_pipeline_take(p_pipeline, 10) == 0 ) goto done;
+
+    // Collect the squares, and stop at the element that fills the take
+    if ( array_pipeline_collect(p_pipeline, &p_result) == 0 ) goto done;
+    if ( array_size(p_result) != taken || visits != ( ( count < 19 ) ? count : 19 ) ) goto done;
+
+    // The squares are in order
+    for (size_t i = 0; i < taken; i++)
+    {
+
+        // Get the square
+        array_sized_index(p_result, (signed) i, &square);
+
+        // Check it
+        if ( square != 4 * i * i ) goto done;
+
+        // Sum it
+        expect_sum += square;
+    }
+
+    // Every other terminal agrees
+    if ( array_pipeline_count(p_pipeline, &size) == 0 || size != taken ) goto done;
+    if ( array_pipeline_reduce(p_pipeline, &sum, sum_parallel, (void *) 0) == 0 || sum != expect_sum ) goto done;
+    if ( array_pipeline_first(p_pipeline, &first) == 0 || first != 0 ) goto done;
+    if ( array_pipeline_foreach(p_pipeline, is_square_of_index, &checked) == 0 || checked != taken ) goto done;
+
+    // Success
+    result = match;
+
+    done:
+
+    // Destroy the pipeline and the arrays
+    if ( p_pipeline ) array_pipeline_destroy(&p_pipeline);
+    if ( p_result   ) array_destroy(&p_result);
+    array_destroy(&p_array);
+
+    // Return result
+    return (result == expected);
+}
+
+bool test_pipeline_empty ( result_t expected )
+{
+
+    // Initialized data
+    result_t        result     = zero;
+    array          *p_array    = 0,
+                   *p_result   = 0;
+    array_pipeline *p_none     = 0,
+                   *p_zero     = 0;
+    size_t          visits     = 0,
+                    size       = 1;
+    void           *p_first    = 0;
+
+    // [] -> add(D) x 100
+    if ( array_construct(&p_array, 1) == 0 ) goto done;
+    for (size_t i = 0; i < 100; i++) array_add(p_array, D_element);
+
+    // filter(not D)
+    if ( array_pipeline_construct(&p_none, p_array) == 0 ) goto done;
+    if ( array_pipeline_filter(p_none, is_not_D, (void *) 0) == 0 ) goto done;
+
+    // Nothing leaves the pipeline
+    if ( array_pipeline_first(p_none, &p_first) != 0 ) goto done;
+    if ( array_pipeline_count(p_none, &size) == 0 || size != 0 ) goto done;
+    if ( array_pipeline_collect(p_none, &p_result) == 0 || array_size(p_result) != 0 ) goto done;
+
+    // filter(visit) -> take(0)
+    if ( array_pipeline_construct_sized(&p_zero, p_array) == 0 ) goto done;
+    if ( array_pipeline_filter(p_zero, is_even_visit, &visits) == 0 ) goto done;
+    if ( array_pipeline_take(p_zero, 0) == 0 ) goto done;
+
+    // Nothing is read
+    size   = 1;
+    result = ( array_pipeline_count(p_zero, &size) == 1 && size == 0 && visits == 0 ) ? match : zero;
+
+    done:
+
+    // Destroy the pipelines and the arrays
+    if ( p_none   ) array_pipeline_destroy(&p_none);
+    if ( p_zero   ) array_pipeline_destroy(&p_zero);
+    if ( p_result ) array_destroy(&p_result);
+    array_destroy(&p_array);
+
+    // Return result
+    return (result == expected);
+}
+
+bool test_pointer_functions_sized ( result_t expected )
+{
+
+    // Initialized data
+    result_t        result     = zero;
+    array          *p_bytes    = 0,
+                   *p_ints     = 0,
+                   *p_result   = 0;
+    array_pipeline *p_pipeline = 0;
+    void           *p_value    = 0;
+    int             value      = 0;
+
+    // Construct a sized array of bytes, and a sized array of [0, 1, 2, 3]
+    if ( array_construct_sized(&p_bytes, 64, 1) == 0 ) goto done;
+    if ( array_construct_sized(&p_ints, 4, sizeof(int)) == 0 ) goto done;
+    for (value = 0; value < 4; value++) array_sized_add(p_ints, &value);
+
+    // Adding a pointer fails, no matter how often
+    for (size_t i = 0; i < 200; i++)
+        if ( array_add(p_bytes, A_element) ) goto done;
+
+    // Nothing was written
+    if ( array_size(p_bytes) != 0 ) goto done;
+
+    // Every other function for arrays of pointers fails
+    if ( array_index(p_ints, -1, &p_value)                      != 0 ) goto done;
+    if ( array_set(p_ints, 0, A_element)                        != 0 ) goto done;
+    if ( array_remove(p_ints, 0, &p_value)                      != 0 ) goto done;
+    if ( array_sort(p_ints, compare_string, (void *) 0)         != 0 ) goto done;
+    if ( array_map(p_ints, &p_result, map_index, (void *) 0, 0) != 0 ) goto done;
+    if ( array_pipeline_construct(&p_pipeline, p_ints)          != 0 ) goto done;
+
+    // The sized functions still work
+    if ( array_sized_index(p_ints, -1, &value) == 0 || value != 3 ) goto done;
+
+    // Success
+    result = match;
+
+    done:
+
+    // Destroy the arrays
+    if ( p_result   ) array_destroy(&p_result);
+    if ( p_pipeline ) array_pipeline_destroy(&p_pipeline);
+    if ( p_bytes    ) array_destroy(&p_bytes);
+    if ( p_ints     ) array_destroy(&p_ints);
+
+    // Return result
+    return (result == expected);
+}
+
+bool test_reserve_overflow ( result_t expected )
+{
+
+    // Initialized data
+    result_t  result  = zero;
+    array    *p_array = 0,
+             *p_sized = 0;
+
+    // [] -> reserve(SIZE_MAX / sizeof(void *) + 1)
+    if ( array_construct(&p_array, 1) == 0 ) goto done;
+    if ( array_reserve(p_array, SIZE_MAX / sizeof(void *) + 1) != 0 ) goto done;
+
+    // The capacity is unchanged
+    if ( array_capacity(p_array) != 1 ) goto done;
+
+    // [] -> add(A) -> add(B) -> add(C) -> [A, B, C]
+    if ( array_add(p_array, A_element) == 0 ) goto done;
+    if ( array_add(p_array, B_element) == 0 ) goto done;
+    if ( array_add(p_array, C_element) == 0 ) goto done;
+
+    // Constructing too many elements fails
+    result = ( array_size(p_array) == 3 && array_construct_sized(&p_sized, SIZE_MAX / 4 + 1, 4) == 0 ) ? match : zero;
+
+    done:
+
+    // Destroy the arrays
+    if ( p_array ) array_destroy(&p_array);
+    if ( p_sized ) array_destroy(&p_sized);
+
+    // Return result
+    return (result == expected);
+}
+
+bool test_growth_overflow ( result_t expected )
+{
+
+    // Initialized data
+    result_t  result  = zero;
+    array    *p_fixed = 0,
+             *p_huge  = 0;
+
+    // [] -> growth(fixed, SIZE_MAX / 2) -> add(A) -> add(B) -> add(C) -> [A, B, C]
+    if ( array_construct(&p_fixed, 1) == 0 ) goto done;
+    if ( array_growth_set(p_fixed, ARRAY_GROWTH_FIXED, SIZE_MAX / 2, (void *) 0) == 0 ) goto done;
+    if ( array_add(p_fixed, A_element) == 0 ) goto done;
+    if ( array_add(p_fixed, B_element) == 0 ) goto done;
+    if ( array_add(p_fixed, C_element) == 0 ) goto done;
+
+    // The capacity is what was really allocated
+    if ( array_capacity(p_fixed) != 3 ) goto done;
+
+    // [] -> growth(callback, SIZE_MAX) -> add(A) -> add(B) -> add(C) -> [A, B, C]
+    if ( array_construct(&p_huge, 1) == 0 ) goto done;
+    if ( array_growth_set(p_huge, ARRAY_GROWTH_CALLBACK, 0, growth_unbounded) == 0 ) goto done;
+    if ( array_add(p_huge, A_element) == 0 ) goto done;
+    if ( array_add(p_huge, B_element) == 0 ) goto done;
+    if ( array_add(p_huge, C_element) == 0 ) goto done;
+
+    // The capacity is what was really allocated
+    result = ( array_capacity(p_huge) == 3 && array_size(p_fixed) == 3 && array_size(p_huge) == 3 ) ? match : zero;
+
+    done:
+
+    // Destroy the arrays
+    if ( p_fixed ) array_destroy(&p_fixed);
+    if ( p_huge  ) array_destroy(&p_huge);
+
+    // Return result
+    return (result == expected);
+}
+
+bool test_seqlock_retired ( result_t expected )
+{
+
+    // Initialized data
+    result_t         result   = zero;
+    array           *p_array  = 0;
+    array_allocator  counting = { .pfn_realloc = counting_realloc, .pfn_free = counting_free, .p_context = allocations };
+    size_t           capacity = 0;
+
+    // Reset the counters
+    allocations[0] = 0,
+    allocations[1] = 0;
+
+    // seqlock [] -> growth(fixed, 1) -> add(A) x 1024
+    if ( array_construct_allocator(&p_array, 1, sizeof(void *), ARRAY_SYNC_SEQLOCK, &counting) == 0 ) goto done;
+    if ( array_growth_set(p_array, ARRAY_GROWTH_FIXED, 1, (void *) 0) == 0 ) goto done;
+    for (size_t i = 0; i < 1024; i++)
+        if ( array_add(p_array, A_element) == 0 ) goto done;
+
+    // The storage doubled, so it was replaced about ten times instead of 1024
+    if ( array_capacity(p_array) < 1024 || allocations[1] > 12 ) goto done;
+
+    // seqlock [A, ...] -> clear -> shrink_to_fit -> []
+    capacity = array_capacity(p_array);
+    if ( array_clear(p_array) == 0 ) goto done;
+    if ( array_shrink_to_fit(p_array) == 0 ) goto done;
+
+    // The storage was kept, instead of being retired
+    if ( array_capacity(p_array) != capacity || allocations[1] > 12 ) goto done;
+
+    // Destroy the array
+    array_destroy(&p_array);
+
+    // Every allocation was freed
+    result = ( allocations[1] == 0 ) ? match : zero;
+
+    done:
+
+    // Destroy the array
+    if ( p_array ) array_destroy(&p_array);
+
+    // Return result
+    return (result == expected);
+}
+
+bool test_construct_no_mem ( result_t expected )
+{
+
+    // Initialized data
+    result_t         result  = zero;
+    array           *p_array = 0;
+    array_allocator  failing = { .pfn_realloc = failing_realloc, .pfn_free = counting_free, .p_context = allocations };
+
+    // Reset the counters
+    allocations[0] = 0,
+    allocations[1] = 0;
+
+    // The array allocates, and its storage fails to
+    if ( array_construct_allocator(&p_array, 4096, sizeof(void *), test_sync, &failing) ) goto done;
+
+    // The array was freed
+    result = ( allocations[0] == 1 && allocations[1] == 0 ) ? match : zero;
+
+    done:
+
+    // Destroy the array
+    if ( p_array ) array_destroy(&p_array);
+
+    // Return result
+    return (result == expected);
+}
+
+bool test_remove_unordered_many_invalid ( result_t expected )
+{
+
+    // Initialized data
+    result_t  result      = zero;
+    array    *p_array     = 0;
+    signed    duplicate[] = { 2, -1 },
+              outside[]   = { 1, 3 };
+    void     *p_values[2] = { 0, 0 };
+
+    // Construct an [A, B, C] array
+    construct_AB_addC_ABC(&p_array);
+
+    // [A, B, C] -> remove_unordered_many(2, -1) -> [A, B, C]
+    if ( array_remove_unordered_many(p_array, duplicate, 2, p_values) != 0 ) goto done;
+
+    // [A, B, C] -> remove_unordered_many(1, 3) -> [A, B, C]
+    if ( array_remove_unordered_many(p_array, outside, 2, p_values) != 0 ) goto done;
+
+    // Nothing was returned, and nothing was removed
+    result = ( p_values[0] == 0 && p_values[1] == 0 && array_size(p_array) == 3 ) ? match : zero;
+
+    done:
+
+    // Destroy the array
+    if ( p_array ) array_destroy(&p_array);
+
+    // Return result
+    return (result == expected);
+}
+
+bool test_size ( void(*array_constructor)(array **pp_array), size_t expected_size, result_t expected )
+{
+
+    // Initialized data
+    result_t  result  = 0;
+    array    *p_array = 0;
+
+    // Build the array
+    array_constructor(&p_array);
+
+    // Get the result of the size operation
+    result = ( array_size(p_array) == expected_size ) ? match : zero;
+
+    // Free the array
+    array_destroy(&p_array);
+
+    // Return result
+    return (result == expected);
+}
+
+bool test_capacity ( void(*array_constructor)(array **pp_array), size_t expected_capacity, result_t expected )
+{
+
+    // Initialized data
+    result_t  result  = 0;
+    array    *p_array = 0;
+
+    // Build the array
+    array_constructor(&p_array);
+
+    // Get the result of the capacity operation
+    result = ( array_capacity(p_array) == expected_capacity ) ? match : zero;
+
+    // Free the array
+    array_destroy(&p_array);
+
+    // Return result
+    return (result == expected);
+}
+
+bool test_index ( void(*array_constructor)(array **pp_array), signed idx, void *expected_value, result_t expected )
+{
+
+    // Initialized data
+    result_t  result       = 0;
+    array    *p_array      = 0;
+    void     *result_value = 0;
+
+    // Build the array
+    array_constructor(&p_array);
+
+    // Index the array
+    result = (result_t) array_index(p_array, idx, &result_value);
+    
+    if ( result == 1 )
+        if ( result_value == expected_value )
+            result = match;
+
+    // Free the array
+    array_destroy(&p_array);
+
+    // Return result
+    return (result == expected);
+}
+
+bool test_slice ( void(*array_constructor)(array **pp_array), signed lower, signed upper, void **expected_value, result_t expected )
+{
+
+    // Initialized data
+    result_t  result          = 0;
+    array    *p_array         = 0;
+    void     *result_values[] = { 0, 0, 0, 0, (void *) 0 };
+
+    // Build the array
+    array_constructor(&p_array);
+
+    // Index the array
+    result = (result_t) array_slice(p_array, result_values, lower, upper);
+    
+    // Error check
+    if ( result == zero ) goto done;
+
+    // Test is successful if ...
+    result = match;
+
+    // ... each element in the slice ...
+    for (signed i = 0; i < upper-lower; i++)
+
+        // ... matches each expected value ...
+        if ( result_values[i] != expected_value[i] )
+
+            // ... else the test failed
+            result = zero;
+
+    done:
+
+    // Free the array
+    array_destroy(&p_array);
+
+    // Return result
+    return (result == expected);
+}
+
+bool test_remove_range ( void(*array_constructor)(array **pp_array), signed lower, signed upper, void **expected_value, result_t expected )
+{
+
+    // Initialized data
+    result_t  result          = 0;
+    array    *p_array         = 0;
+    void     *result_values[] = { 0, 0, 0, 0, (void *) 0 };
+
+    // Build the array
+    array_constructor(&p_array);
+
+    // Remove the range
+    result = (result_t) array_remove_range(p_array, lower, upper, result_values);
+    
+    // Error check
+    if ( result == zero ) goto done;
+
+    // Test is successful if ...
+    result = match;
+
+    // ... each removed element ...
+    for (signed i = 0; i <= upper-lower; i++)
+
+        // ... matches each expected value ...
+        if ( result_values[i] != expected_value[i] )
+
+            // ... else the test failed
+            result = zero;
+
+    done:
+
+    // Free the array
+    array_destroy(&p_array);
+
+    // Return result
+    return (result == expected);
+}
+
+void construct_empty ( array **pp_array )
+{
+
+    // Construct an array
+    array_construct_sync(pp_array, 4, test_sync);
+
+    // array = []
+    return;
+}
+
+void construct_empty_addA_A ( array **pp_array )
+{
+
+    // Construct a [] array
+    construct_empty(pp_array);
+
+    // [] -> add(A) -> [A]
+    array_add(*pp_array, A_element);
+ 
+    // array = [A]
+    return;
+}
+
+void construct_A_addB_AB ( array **pp_array )
+{
+
+    // Construct an [A] array 
+    construct_empty_addA_A(pp_array);
+
+    // [A] -> add(B) -> [B]
+    array_add(*pp_array , B_element);
+ 
+    // array = [A, B]
+    return;
+}
+
+void construct_AB_addC_ABC ( array **pp_array )
+{
+
+    // Construct an [A, B] array
+    construct_A_addB_AB(pp_array);
+
+    // [A, B] -> add(C) -> [A, B, C]
+    array_add(*pp_array, C_element);
+
+    // array = [A, B, C]
+    return;
+}
+
+void construct_empty_addmanyABC_ABC ( array **pp_array )
+{
+
+    // Construct a [] array that must grow
+    array_construct_sync(pp_array, 1, test_sync);
+
+    // [] -> add_many(A, B, C) -> [A, B, C]
+    array_add_many(*pp_array, (void **)ABC_elements, 3);
+
+    // array = [A, B, C]
+    return;
+}
+
+void construct_A_addmanyBC_ABC ( array **pp_array )
+{
+
+    // Construct an [A] array
+    construct_empty_addA_A(pp_array);
+
+    // [A] -> add_many(B, C) -> [A, B, C]
+    array_add_many(*pp_array, (void **)BC_elements, 2);
+
+    // array = [A, B, C]
+    return;
+}
+
+void construct_AC_insert1B_ABC ( array **pp_array )
+{
+
+    // Construct an [A, C] array
+    array_construct_sync(pp_array, 2, test_sync);
+    array_add_many(*pp_array, (void **)AC_elements, 2);
+
+    // [A, C] -> insert(1, B) -> [A, B, C]
+    array_insert(*pp_array, 1, B_element);
+
+    // array = [A, B, C]
+    return;
+}
+
+void construct_BC_insertneg2A_ABC ( array **pp_array )
+{
+
+    // Construct a [B, C] array
+    array_construct_sync(pp_array, 2, test_sync);
+    array_add_many(*pp_array, (void **)BC_elements, 2);
+
+    // [B, C] -> insert(-2, A) -> [A, B, C]
+    array_insert(*pp_array, -2, A_element);
+
+    // array = [A, B, C]
+    return;
+}
+
+void construct_A_insertmany1BC_ABC ( array **pp_array )
+{
+
+    // Construct an [A] array
+    construct_empty_addA_A(pp_array);
+
+    // [A] -> insert_many(1, B, C) -> [A, B, C]
+    array_insert_many(*pp_array, 1, (void **)BC_elements, 2);
+
+    // array = [A, B, C]
+    return;
+}
+
+void construct_C_insertmany0AB_ABC ( array **pp_array )
+{
+
+    // Construct a [C] array
+    array_construct_sync(pp_array, 1, test_sync);
+    array_add(*pp_array, C_element);
+
+    // [C] -> insert_many(0, A, B) -> [A, B, C]
+    array_insert_many(*pp_array, 0, (void **)AB_elements, 2);
+
+    // array = [A, B, C]
+    return;
+}
+
+void construct_ABC_clear_empty ( array **pp_array )
+{
+
+    // Construct an [A, B, C] array
+    construct_AB_addC_ABC(pp_array);
+
+    // [A, B, C] -> clear() -> []
+    array_clear(*pp_array);
+
+    // array = []
+    return;
+}
+
+void construct_AB_clear_empty ( array **pp_array )
+{
+
+    // Construct an [A, B] array
+    construct_A_addB_AB(pp_array);
+
+    // [A, B] -> clear() -> []
+    array_clear(*pp_array);
+
+    // array = []
+    return;
+}
+
+void construct_A_clear_empty ( array **pp_array )
+{
+
+    // Construct an [A] array
+    construct_empty_addA_A(pp_array);
+
+    // [A] -> clear() -> []
+    array_clear(*pp_array);
+
+    // array = []
+    return;
+}
+
+void construct_empty_fromelementsABC_ABC ( array **pp_array )
+{
+
+    // ... -> from_elements(A, B, C) -> [A, B, C]
+    array_from_elements(pp_array, (void **)ABC_elements);
+    
+    // array = [A, B, C]
+    return;
+}
+
+void construct_empty_fromelementsAB_AB ( array **pp_array )
+{
+
+    // ... -> from_elements(A, B) -> [A, B]
+    array_from_elements(pp_array, (void **)AB_elements);
+
+    // array = [A, B]
+    return;
+}
+
+void construct_empty_fromelementsA_A ( array **pp_array )
+{
+
+    // ... -> from_elements(A) -> [A]
+    array_from_elements(pp_array, (void **)A_elements);
+
+    // array = [A]
+    return;
+}
+
+void construct_empty_fromargumentsABC_ABC ( array **pp_array )
+{
+
+    // ... -> from_arguments(A, B, C) -> [A, B, C]
+    array_from_arguments(pp_array, 3, 3, "A", "B", "C");
+    
+    // array = [A, B, C]
+    return;
+}
+
+void construct_empty_fromargumentsAB_AB ( array **pp_array )
+{
+
+    // ... -> from_arguments(A, B) -> [A, B]
+    array_from_arguments(pp_array, 2, 2, "A", "B");
+
+    // array = [A, B]
+    return;
+}
+
+void construct_empty_fromargumentsA_A ( array **pp_array )
+{
+
+    // ... -> from_arguments(A) -> [A]
+    array_from_arguments(pp_array, 1, 1, "A");
+
+    // array = [A]
+    return;
+}
+
+void construct_A_remove0_empty ( array **pp_array )
+{
+
+    // Construct an [A] array
+    construct_empty_addA_A(pp_array);
+
+    // [A] -> remove(0) -> []
+    array_remove(*pp_array, 0, (void *)0);
+
+    // array = []
+    return;
+}
+
+void construct_AB_remove1_A ( array **pp_array )
+{
+
+    // Construct an [A, B] array
+    construct_A_addB_AB(pp_array);
+
+    // [A, B] -> remove(1) -> [A]
+    array_remove(*pp_array, 1, (void *)0);
+
+    // array = []
+    return;
+}
+
+void construct_ABC_remove2_AB ( array **pp_array )
+{
+
+    // Construct an [A, B, C] array
+    construct_AB_addC_ABC(pp_array);
+
+    // [A, B, C] -> remove(2) -> [A, B]
+    array_remove(*pp_array, 2, (void *)0);
+
+    // array = []
+    return;
+}
+
+void construct_ABC_removeunordered0_CB ( array **pp_array )
+{
+
+    // Construct an [A, B, C] array
+    construct_AB_addC_ABC(pp_array);
+
+    // [A, B, C] -> remove_unordered(0) -> [C, B]
+    array_remove_unordered(*pp_array, 0, (void *)0);
+
+    // array = [C, B]
+    return;
+}
+
+void construct_ABC_removeunordered1_AC ( array **pp_array )
+{
+
+    // Construct an [A, B, C] array
+    construct_AB_addC_ABC(pp_array);
+
+    // [A, B, C] -> remove_unordered(1) -> [A, C]
+    array_remove_unordered(*pp_array, 1, (void *)0);
+
+    // array = [A, C]
+    return;
+}
+
+void construct_ABC_removeunorderedmany02_B ( array **pp_array )
+{
+
+    // Initialized data
+    signed indices[] = { 0, -1 };
+
+    // Construct an [A, B, C] array
+    construct_AB_addC_ABC(pp_array);
+
+    // [A, B, C] -> remove_unordered_many(0, 2) -> [B]
+    array_remove_unordered_many(*pp_array, indices, 2, (void *)0);
+
+    // array = [B]
+    return;
+}
+
+void construct_ABC_removerange01_C ( array **pp_array )
+{
+
+    // Construct an [A, B, C] array
+    construct_AB_addC_ABC(pp_array);
+
+    // [A, B, C] -> remove_range(0, 1) -> [C]
+    array_remove_range(*pp_array, 0, 1, (void *)0);
+
+    // array = [C]
+    return;
+}
+
+void construct_ABC_removerange12_A ( array **pp_array )
+{
+
+    // Construct an [A, B, C] array
+    construct_AB_addC_ABC(pp_array);
+
+    // [A, B, C] -> remove_range(1, 2) -> [A]
+    array_remove_range(*pp_array, 1, 2, (void *)0);
+
+    // array = [A]
+    return;
+}
+
+void construct_ABC_removerange02_empty ( array **pp_array )
+{
+
+    // Construct an [A, B, C] array
+    construct_AB_addC_ABC(pp_array);
+
+    // [A, B, C] -> remove_range(0, 2) -> []
+    array_remove_range(*pp_array, 0, 2, (void *)0);
+
+    // array = []
+    return;
+}
+
+void test_empty_array ( void (*array_constructor)(array **pp_array), char *name)
+{
+
+    // Formatting
+    log_info("Scenario: %s\n", name);
+
+    // Test the add function
+    print_test(name, "array_add_A", test_add(array_constructor, A_element, one) );
+    print_test(name, "array_add_B", test_add(array_constructor, B_element, one) );
+
+    // Test the index function
+    print_test(name, "array_index0", test_index(array_constructor, 0, (void *)0, zero) );
+    print_test(name, "array_index1", test_index(array_constructor, 1, (void *)0, zero) );
+
+    // Test the get function
+    print_test(name, "array_get", test_get(array_constructor, (void **)_elements, zero) );    
+
+    // Test the count 
+    print_test(name, "array_get_count", test_get_count(array_constructor, 0, match) );
+    print_test(name, "array_view", test_view(array_constructor, (void **)_elements, 0, match) );
+    
+    // Test the remove function
+    print_test(name, "array_remove0", test_remove(array_constructor, (void *)0, 0, zero) );
+
+    // Print the summary of this test
+    print_final_summary();
+
+    // Done
+    return;
+}
+
+void test_one_element_array ( void (*array_constructor)(array **pp_array), char *name, void **values )
+{
+
+    // Formatting
+    log_info("SCENARIO: %s\n", name);
+
+    // Test the add function
+    print_test(name, "array_add_D", test_add(array_constructor, D_element, one) );
+    
+    // Test the get function
+    print_test(name, "array_get"      , test_get(array_constructor, values, zero) );
+    print_test(name, "array_get_count", test_get_count(array_constructor, 1, match) );
+    print_test(name, "array_view"     , test_view(array_constructor, values, 1, match) );
+
+    // Test the size function
+    print_test(name, "array_size", test_size(array_constructor, 1, match));
+    
+    // Test the index function
+    print_test(name, "array_index0", test_index(array_constructor, 0, values[0], match) );
+    print_test(name, "array_index1", test_index(array_constructor, 1, (void *)0, zero) );
+
+    // Test the remove function
+    print_test(name, "array_remove0", test_remove(array_constructor, values[0], 0, match) );
+    print_test(name, "array_remove1", test_remove(array_constructor, (void *)0, 1, zero) );
+
+    // Print the summary of this test   
+    print_final_summary();
+    
+    // Done
+    return;
+}
+
+void test_two_element_array ( void (*array_constructor)(array **pp_array), char *name, void **values )
+{
+    
+    // Formatting
+    log_info("SCENARIO: %s\n", name);
+
+    // Test the add function
+    print_test(name, "array_add_D", test_add(array_constructor, D_element, one) );
+    
+    // Test the get function
+    print_test(name, "array_get"      , test_get(array_constructor, values, zero) );
+    print_test(name, "array_get_count", test_get_count(array_constructor, 2, match) );
+    print_test(name, "array_view"     , test_view(array_constructor, values, 2, match) );
+
+    // Test the size function
+    print_test(name, "array_size", test_size(array_constructor, 2, match));
+    
+    // Test the index function
+    print_test(name, "array_index0", test_index(array_constructor, 0, values[0], match) );
+    print_test(name, "array_index1", test_index(array_constructor, 1, values[1], match) );  
+    print_test(name, "array_index2", test_index(array_constructor, 2, (void *)0, zero) );  
+
+    // Test the remove function    
+    print_test(name, "array_remove0", test_remove(array_constructor, values[0], 0, match) );
+    print_test(name, "array_remove1", test_remove(array_constructor, values[1], 1, match) );
+    print_test(name, "array_remove2", test_remove(array_constructor, (void *)0, 2, zero) );
+
+    // Print the summary of this test
+    print_final_summary();
+    
+    // Done
+    return;
+}
+
+void test_three_element_array ( void (*array_constructor)(array **pp_array), char *name, void **values )
+{
+
+    // Formatting
+    log_info("SCENARIO: %s\n", name);
+
+    // Test the add function
+    print_test(name, "array_add_D", test_add(array_constructor, D_element, one) );
+    
+    // Test the get function
+    print_test(name, "array_get", test_get(array_constructor, values, zero) );
+    print_test(name, "array_get_count", test_get_count(array_constructor, 3, match) );
+    print_test(name, "array_view", test_view(array_constructor, values, 3, match) );
+
+    // Test the size function
+    print_test(name, "array_size", test_size(array_constructor, 3, match));
+    
+    // Test the index function
+    print_test(name, "array_index0"   , test_index(array_constructor, 0, values[0], match) );
+    print_test(name, "array_index1"   , test_index(array_constructor, 1, values[1], match) );  
+    print_test(name, "array_index2"   , test_index(array_constructor, 2, values[2], match) );  
+    print_test(name, "array_index3"   , test_index(array_constructor, 3, (void *)0, zero) );  
+    print_test(name, "array_index-1"  , test_index(array_constructor, -1, values[2], match) );  
+    print_test(name, "array_index-3"  , test_index(array_constructor, -3, values[0], match) );  
+    print_test(name, "array_index-4"  , test_index(array_constructor, -4, (void *)0, zero) );  
+
+    // Test the remove function
+    print_test(name, "array_remove0"  , test_remove(array_constructor, values[0], 0, match) );
+    print_test(name, "array_remove1"  , test_remove(array_constructor, values[1], 1, match) );
+    print_test(name, "array_remove2"  , test_remove(array_constructor, values[2], 2, match) );
+    print_test(name, "array_remove3"  , test_remove(array_constructor, (void *)0, 3, zero) );
+
+    // Test the remove range function
+    print_test(name, "array_remove_range01", test_remove_range(array_constructor, 0, 1, &values[0], match) );
+    print_test(name, "array_remove_range12", test_remove_range(array_constructor, 1, 2, &values[1], match) );
+    print_test(name, "array_remove_range02", test_remove_range(array_constructor, 0, 2, &values[0], match) );
+    print_test(name, "array_remove_range13", test_remove_range(array_constructor, 1, 3, values, zero) );
+    print_test(name, "array_remove_range10", test_remove_range(array_constructor, 1, 0, values, zero) );
+
+    // Print the summary of this test
+    print_final_summary();
+    
+    // Done
+    return;
+}
+
+void construct_ABC_add10Dremoverange312_ABC ( array **pp_array )
+{
+
+    // Construct an [A, B, C] array
+    construct_AB_addC_ABC(pp_array);
+
+    // [A, B, C] -> add(D) x 10 -> [A, B, C, D, D, D, D, D, D, D, D, D, D]
+    for (size_t i = 0; i < 10; i++)
+        array_add(*pp_array, D_element);
+
+    // [A, B, C, D, D, D, D, D, D, D, D, D, D] -> remove_range(3, 12) -> [A, B, C]
+    array_remove_range(*pp_array, 3, 12, (void *)0);
+
+    // array = [A, B, C]
+    return;
+}
+
+void construct_inline_empty_addABC_ABC ( array **pp_array )
+{
+
+    // Construct an empty array in one allocation with room for three elements
+    array_construct_inline(pp_array, 3, sizeof(void *), test_sync);
+
+    // [] -> add(A) -> add(B) -> add(C) -> [A, B, C]
+    array_add(*pp_array, A_element);
+    array_add(*pp_array, B_element);
+    array_add(*pp_array, C_element);
+
+    // array = [A, B, C]
+    return;
+}
+
+void construct_inline1_empty_addABC_ABC ( array **pp_array )
+{
+
+    // Construct an empty array in one allocation with room for one element
+    array_construct_inline(pp_array, 1, sizeof(void *), test_sync);
+
+    // [] -> add(A) -> add(B) -> add(C) -> [A, B, C]
+    array_add(*pp_array, A_element);
+    array_add(*pp_array, B_element);
+    array_add(*pp_array, C_element);
 
-    // Exit
-    return ( total_passes == total_tests ) ? EXIT_SUCCESS : EXIT_FAILURE;
+    // array = [A, B, C]
+    return;
 }
 
-void print_time_pretty ( double seconds )
+void construct_allocator_empty_addABCreserve16_ABC ( array **pp_array )
 {
 
     // Initialized data
-    double _seconds     = seconds;
-    size_t days         = 0,
-           hours        = 0,
-           minutes      = 0,
-           __seconds    = 0,
-           milliseconds = 0,
-           microseconds = 0;
+    array_allocator counting = { .pfn_realloc = counting_realloc, .pfn_free = counting_free, .p_context = allocations };
 
-    // Days
-    while ( _seconds > 86400.0 ) { days++;_seconds-=286400.0; };
+    // Construct an empty array with the counting allocator
+    array_construct_allocator(pp_array, 1, sizeof(void *), test_sync, &counting);
 
-    // Hours
-    while ( _seconds > 3600.0 ) { hours++;_seconds-=3600.0; };
+    // [] -> add(A) -> add(B) -> add(C) -> reserve(16) -> [A, B, C]
+    array_add(*pp_array, A_element);
+    array_add(*pp_array, B_element);
+    array_add(*pp_array, C_element);
+    array_reserve(*pp_array, 16);
 
-    // Minutes
-    while ( _seconds > 60.0 ) { minutes++;_seconds-=60.0; };
+    // array = [A, B, C]
+    return;
+}
 
-    // Seconds
-    while ( _seconds > 1.0 ) { __seconds++;_seconds-=1.0; };
+void *counting_realloc ( void *p_context, void *p_memory, size_t size )
+{
 
-    // milliseconds
-    while ( _seconds > 0.001 ) { milliseconds++;_seconds-=0.001; };
+    // Initialized data
+    size_t *p_allocations = p_context;
 
-    // Microseconds        
-    while ( _seconds > 0.000001 ) { microseconds++;_seconds-=0.000001; };
+    // Count new allocations
+    if ( p_memory == (void *) 0 ) p_allocations[0]++, p_allocations[1]++;
 
-    // Print days
-    if ( days ) log_info("%zu D, ", days);
-    
-    // Print hours
-    if ( hours ) log_info("%zu h, ", hours);
+    // Reallocate
+    return realloc(p_memory, size);
+}
 
-    // Print minutes
-    if ( minutes ) log_info("%zu m, ", minutes);
+void counting_free ( void *p_context, void *p_memory )
+{
 
-    // Print seconds
-    if ( __seconds ) log_info("%zu s, ", __seconds);
-    
-    // Print milliseconds
-    if ( milliseconds ) log_info("%zu ms, ", milliseconds);
-    
-    // Print microseconds
-    if ( microseconds ) log_info("%zu us", microseconds);
-    
-    // Done
-    return;
+    // Initialized data
+    size_t *p_allocations = p_context;
+
+    // Count frees
+    p_allocations[1]--;
+
+    // Free
+    free(p_memory);
 }
 
-void run_tests ( void )
+void *failing_realloc ( void *p_context, void *p_memory, size_t size )
 {
 
-    // ... -> []
-    test_empty_array(construct_empty, "empty");
+    // Initialized data
+    size_t *p_allocations = p_context;
 
-    // ... -> from_elements(A) -> [A]
-    test_one_element_array(construct_empty_fromelementsA_A, "empty_fromelementsA_A", (void **)A_elements);
+    // Fail every allocation after the first
+    if ( p_memory == (void *) 0 && size && p_allocations[0] ) return (void *) 0;
 
-    // ... -> from_elements(A, B) -> [A, B]
-    test_two_element_array(construct_empty_fromelementsAB_AB, "empty_fromelementsAB_AB", (void **)AB_elements);
+    // Count and reallocate
+    return counting_realloc(p_context, p_memory, size);
+}
 
-    // ... -> from_elements(A, B, C) -> [A, B, C]
-    test_three_element_array(construct_empty_fromelementsABC_ABC, "empty_fromelementsABC_ABC", (void **)ABC_elements);
+void construct_arena_empty_addABC10Dremoverange312_ABC ( array **pp_array )
+{
 
-    // ... -> from_arguments(A) -> [A]
-    test_one_element_array(construct_empty_fromargumentsA_A, "empty_fromargumentsA_A", (void **)A_elements);
+    // Construct an empty array in the test arena
+    array_arena_array(p_test_arena, pp_array, 1, sizeof(void *));
 
-    // ... -> from_arguments(A, B) -> [A, B]
-    test_two_element_array(construct_empty_fromargumentsAB_AB, "empty_fromargumentsAB_AB", (void **)AB_elements);
+    // [] -> add(A) -> add(B) -> add(C) -> [A, B, C]
+    array_add(*pp_array, A_element);
+    array_add(*pp_array, B_element);
+    array_add(*pp_array, C_element);
 
-    // ... -> from_arguments(A, B, C) -> [A, B, C]
-    test_three_element_array(construct_empty_fromargumentsABC_ABC, "empty_fromargumentsABC_ABC", (void **)ABC_elements);
-    
-    // [A, B, C] -> clear() -> []
-    test_empty_array(construct_ABC_clear_empty, "ABC_clear_empty");
- 
-    // [A, B] -> clear() -> []
-    test_empty_array(construct_AB_clear_empty, "AB_clear_empty");
+    // [A, B, C] -> add(D) x 10 -> [A, B, C, D, D, D, D, D, D, D, D, D, D]
+    for (size_t i = 0; i < 10; i++)
+        array_add(*pp_array, D_element);
 
-    // [A] -> clear() -> []
-    test_empty_array(construct_A_clear_empty, "A_clear_empty");
+    // [A, B, C, D, D, D, D, D, D, D, D, D, D] -> remove_range(3, 12) -> [A, B, C]
+    array_remove_range(*pp_array, 3, 12, (void *)0);
 
-    // [] -> add(A) -> [A]
-    test_one_element_array(construct_empty_addA_A, "empty_addA_A", (void **)A_elements);
+    // array = [A, B, C]
+    return;
+}
 
-    // [A] -> add(B) -> [A, B]
-    test_two_element_array(construct_A_addB_AB, "A_addB_AB", (void **)AB_elements);
+void construct_pool_10Dreleased_addABC_ABC ( array **pp_array )
+{
 
-    // [A, B] -> add(C) -> [A, B, C]
-    test_three_element_array(construct_AB_addC_ABC, "AB_addC_ABC", (void **)ABC_elements);
+    // Construct an array from the test pool
+    array_pool_array(p_test_pool, pp_array, 1, sizeof(void *), test_sync);
 
-    // [A] -> remove(0) -> []
-    test_empty_array(construct_A_remove0_empty, "A_remove0_empty");
+    // [] -> add(D) x 10 -> [D, D, D, D, D, D, D, D, D, D]
+    for (size_t i = 0; i < 10; i++)
+        array_add(*pp_array, D_element);
 
-    // [A, B] -> remove(1) -> [A]
-    test_one_element_array(construct_AB_remove1_A, "AB_remove1_A", (void **)A_elements);
+    // [D, D, D, D, D, D, D, D, D, D] -> release -> []
+    array_pool_release(p_test_pool, pp_array);
+    array_pool_array(p_test_pool, pp_array, 1, sizeof(void *), test_sync);
 
-    // [A, B, C] -> remove(2) -> [A, B]
-    test_two_element_array(construct_ABC_remove2_AB, "ABC_remove2_AB", (void **)AB_elements);
+    // [] -> add(A) -> add(B) -> add(C) -> [A, B, C]
+    array_add(*pp_array, A_element);
+    array_add(*pp_array, B_element);
+    array_add(*pp_array, C_element);
 
-    // Done
+    // array = [A, B, C]
     return;
 }
 
-void print_final_summary ( void )
+void construct_empty_reserve16_empty ( array **pp_array )
 {
 
-    // Accumulate
-    total_tests  += ephemeral_tests,
-    total_passes += ephemeral_passes,
-    total_fails  += ephemeral_fails;
+    // Construct an empty array
+    construct_empty(pp_array);
 
-    // Print
-    log_info("\nTests: %d, Passed: %d, Failed: %d (%%%.3f)\n",  ephemeral_tests, ephemeral_passes, ephemeral_fails, ((float)ephemeral_passes/(float)ephemeral_tests*100.f));
-    log_info("Total: %d, Passed: %d, Failed: %d (%%%.3f)\n\n",  total_tests, total_passes, total_fails, ((float)total_passes/(float)total_tests*100.f));
-    
-    // Clear test counters for this test
-    ephemeral_tests  = 0;
-    ephemeral_passes = 0;
-    ephemeral_fails  = 0;
+    // [] -> reserve(16) -> []
+    array_reserve(*pp_array, 16);
 
-    // Done
+    // array = []
     return;
 }
 
-void print_test ( const char *scenario_name, const char *test_name, bool passed )
+void construct_empty_shrinktofit_empty ( array **pp_array )
 {
 
-    // Initialized data
-    if ( passed )
-        log_pass("%s %s\n", scenario_name, test_name);
-    else
-        log_fail("%s %s\n", scenario_name, test_name);
-
-
-    // Increment the pass/fail counter
-    if (passed)
-        ephemeral_passes++;
-    else
-        ephemeral_fails++;
+    // Construct an empty array
+    construct_empty(pp_array);
 
-    // Increment the test counter
-    ephemeral_tests++;
+    // [] -> shrink_to_fit() -> []
+    array_shrink_to_fit(*pp_array);
 
-    // Done
+    // array = []
     return;
 }
 
-bool test_add ( void(*array_constructor)(array **pp_array), void *value, result_t expected )
+void construct_ABC_reserve16shrinktofit_ABC ( array **pp_array )
 {
 
-    // Initialized data
-    result_t  result = 0;
-    array     *p_array = 0;
-
-    // Build the array
-    array_constructor(&p_array);
-
-    // Add an element
-    result = (result_t) array_add(p_array, value);
+    // Construct an [A, B, C] array
+    construct_AB_addC_ABC(pp_array);
 
-    // Free the array
-    array_destroy(&p_array);
+    // [A, B, C] -> reserve(16) -> shrink_to_fit() -> [A, B, C]
+    array_reserve(*pp_array, 16);
+    array_shrink_to_fit(*pp_array);
 
-    // Return result
-    return (result == expected);
+    // array = [A, B, C]
+    return;
 }
 
-bool test_remove ( void(*array_constructor)(array **pp_array), void *value, signed index, result_t expected )
+void construct_ABC_shrinkpolicyremove2_AB ( array **pp_array )
 {
 
-    // Initialized data
-    result_t  result  = 0;
-    array    *p_array = 0;
-    void     *p_ret   = (void*) -1;
-
-    // Build the array
-    array_constructor(&p_array);
-
-    // Remove an element
-    result = (result_t) array_remove(p_array, index, &p_ret);
-    
-    // Check for a match
-    result = ( value == p_ret ) ? match : result;
+    // Construct an [A, B, C] array with room for sixteen elements
+    array_construct_sync(pp_array, 16, test_sync);
+    array_shrink_policy_set(*pp_array, 0.25, 2);
+    array_add_many(*pp_array, (void **)ABC_elements, 3);
 
-    // Free the array
-    array_destroy(&p_array);
+    // [A, B, C] -> remove(2) -> [A, B]
+    array_remove(*pp_array, 2, (void *)0);
 
-    // Return result
-    return (result == expected);
+    // array = [A, B]
+    return;
 }
 
-bool test_get ( void(*array_constructor)(array **pp_array), void **expected_values, result_t expected )
+void construct_ABC_shrinkpolicyclear_empty ( array **pp_array )
 {
 
-    // Initialized data
-    result_t  result       = 0;
-    array    *p_array      = 0;
-    void     *result_value = 0;
-
-    // Build the array
-    array_constructor(&p_array);
-
-    // Get a key 
-    //result_value = array_get(p_array, key);
-
-    result = (result_value == expected_values) ? match : zero;
+    // Construct an [A, B, C] array with room for sixteen elements
+    array_construct_sync(pp_array, 16, test_sync);
+    array_shrink_policy_set(*pp_array, 0.25, 2);
+    array_add_many(*pp_array, (void **)ABC_elements, 3);
 
-    // Free the array
-    array_destroy(&p_array);
+    // [A, B, C] -> clear() -> []
+    array_clear(*pp_array);
 
-    // Return result
-    return (result == expected);
+    // array = []
+    return;
 }
 
-bool test_get_count ( void(*array_constructor)(array **pp_array), size_t expected_size, result_t expected )
+void construct_empty_growthhalfaddABC_ABC ( array **pp_array )
 {
 
-    // Initialized data
-    result_t  result       = 0;
-    array    *p_array      = 0;
-    size_t    result_value = 0;
+    // Construct an empty array with room for two elements
+    array_construct_sync(pp_array, 2, test_sync);
 
-    // Build the array
-    array_constructor(&p_array);
+    // [] -> growth(half) -> add_many(A, B, C) -> [A, B, C]
+    array_growth_set(*pp_array, ARRAY_GROWTH_HALF, 0, (void *) 0);
+    array_add_many(*pp_array, (void **)ABC_elements, 3);
 
-    // Get the size of the array
-    array_get(p_array, 0, &result_value);
+    // array = [A, B, C]
+    return;
+}
 
-    // 
-    result = (result_value == expected_size) ? match : zero;
+void construct_empty_growthfixed5addABC_ABC ( array **pp_array )
+{
 
-    // Free the array
-    array_destroy(&p_array);
+    // Construct an empty array with room for two elements
+    array_construct_sync(pp_array, 2, test_sync);
 
-    // Return result
-    return (result == expected);
+    // [] -> growth(fixed, 5) -> add_many(A, B, C) -> [A, B, C]
+    array_growth_set(*pp_array, ARRAY_GROWTH_FIXED, 5, (void *) 0);
+    array_add_many(*pp_array, (void **)ABC_elements, 3);
+
+    // array = [A, B, C]
+    return;
 }
 
-bool test_size ( void(*array_constructor)(array **pp_array), size_t expected_size, result_t expected )
+void construct_empty_growthcallbackaddABC_ABC ( array **pp_array )
 {
 
-    // Initialized data
-    result_t  result  = 0;
-    array    *p_array = 0;
-
-    // Build the array
-    array_constructor(&p_array);
-
-    // Get the result of the size operation
-    result = ( array_size(p_array) == expected_size ) ? match : zero;
+    // Construct an empty array with room for two elements
+    array_construct_sync(pp_array, 2, test_sync);
 
-    // Free the array
-    array_destroy(&p_array);
+    // [] -> growth(callback) -> add_many(A, B, C) -> [A, B, C]
+    array_growth_set(*pp_array, ARRAY_GROWTH_CALLBACK, 0, growth_exact);
+    array_add_many(*pp_array, (void **)ABC_elements, 3);
 
-    // Return result
-    return (result == expected);
+    // array = [A, B, C]
+    return;
 }
 
-bool test_index ( void(*array_constructor)(array **pp_array), signed idx, void *expected_value, result_t expected )
+void construct_empty_growthusableaddABC_ABC ( array **pp_array )
 {
 
-    // Initialized data
-    result_t  result       = 0;
-    array    *p_array      = 0;
-    void     *result_value = 0;
-
-    // Build the array
-    array_constructor(&p_array);
-
-    // Index the array
-    result = (result_t) array_index(p_array, idx, &result_value);
-    
-    if ( result == 1 )
-        if ( result_value == expected_value )
-            result = match;
+    // Construct an empty array with room for one element
+    array_construct_sync(pp_array, 1, test_sync);
 
-    // Free the array
-    array_destroy(&p_array);
+    // [] -> growth(usable size) -> add(A) -> add(B) -> add(C) -> [A, B, C]
+    array_growth_set(*pp_array, ARRAY_GROWTH_DOUBLE | ARRAY_GROWTH_USABLE_SIZE, 0, (void *) 0);
+    array_add(*pp_array, A_element);
+    array_add(*pp_array, B_element);
+    array_add(*pp_array, C_element);
 
-    // Return result
-    return (result == expected);
+    // array = [A, B, C]
+    return;
 }
 
-bool test_slice ( void(*array_constructor)(array **pp_array), signed lower, signed upper, void **expected_value, result_t expected )
+size_t growth_exact ( size_t max, size_t required )
 {
 
-    // Initialized data
-    result_t  result          = 0;
-    array    *p_array         = 0;
-    void     *result_values[] = { 0, 0, 0, 0, (void *) 0 };
+    // Unused
+    (void) max;
 
-    // Build the array
-    array_constructor(&p_array);
+    // Success
+    return required;
+}
 
-    // Index the array
-    result = (result_t) array_slice(p_array, result_values, lower, upper);
-    
-    // Error check
-    if ( result == zero ) goto done;
+size_t growth_unbounded ( size_t max, size_t required )
+{
 
-    // Test is successful if ...
-    result = match;
+    // Unused
+    (void) max;
+    (void) required;
 
-    // ... each element in the slice ...
-    for (signed i = 0; i < upper-lower; i++)
+    // Success
+    return SIZE_MAX;
+}
 
-        // ... matches each expected value ...
-        if ( result_values[i] != expected_value[i] )
+void test_sized_three_element_array ( void (*array_constructor)(array **), char *name, const record *values )
+{
 
-            // ... else the test failed
-            result = zero;
+    // Formatting
+    log_info("SCENARIO: %s\n", name);
+
+    // Test the size function
+    print_test(name, "array_size", test_size(array_constructor, 3, match));
 
-    done:
+    // Test the sized index function
+    print_test(name, "array_sized_index0" , test_sized_index(array_constructor, 0, &values[0], match) );
+    print_test(name, "array_sized_index1" , test_sized_index(array_constructor, 1, &values[1], match) );
+    print_test(name, "array_sized_index2" , test_sized_index(array_constructor, 2, &values[2], match) );
+    print_test(name, "array_sized_index3" , test_sized_index(array_constructor, 3, &values[0], zero) );
+    print_test(name, "array_sized_index-1", test_sized_index(array_constructor, -1, &values[2], match) );
+    print_test(name, "array_sized_index-4", test_sized_index(array_constructor, -4, &values[0], zero) );
 
-    // Free the array
-    array_destroy(&p_array);
+    // Test the sized remove function
+    print_test(name, "array_sized_remove0", test_sized_remove(array_constructor, 0, &values[0], match) );
+    print_test(name, "array_sized_remove2", test_sized_remove(array_constructor, 2, &values[2], match) );
+    print_test(name, "array_sized_remove3", test_sized_remove(array_constructor, 3, &values[0], zero) );
 
-    // Return result
-    return (result == expected);
+    // Test the sized foreach function
+    print_test(name, "array_sized_foreach_i", test_sized_foreach_i(array_constructor, values[0].a + values[1].a + values[2].a, match) );
+
+    // Print the summary of this test
+    print_final_summary();
+    
+    // Done
+    return;
 }
 
-void construct_empty ( array **pp_array )
+void construct_sized_empty_addABC_ABC ( array **pp_array )
 {
 
-    // Construct an array
-    array_construct(pp_array, 4);
+    // Construct an empty sized array with room for one record
+    array_construct_sized_sync(pp_array, 1, sizeof(record), test_sync);
 
-    // array = []
+    // [] -> add(A) -> add(B) -> add(C) -> [A, B, C]
+    array_sized_add(*pp_array, &A_record);
+    array_sized_add(*pp_array, &B_record);
+    array_sized_add(*pp_array, &C_record);
+
+    // array = [A, B, C]
     return;
 }
 
-void construct_empty_addA_A ( array **pp_array )
+void construct_sized_empty_emplaceABC_ABC ( array **pp_array )
 {
 
-    // Construct a [] array
-    construct_empty(pp_array);
+    // Construct an empty sized array with room for one record
+    array_construct_sized_sync(pp_array, 1, sizeof(record), test_sync);
 
-    // [] -> add(A) -> [A]
-    array_add(*pp_array, A_element);
- 
-    // array = [A]
+    // [] -> emplace(A) -> emplace(B) -> emplace(C) -> [A, B, C]
+    array_sized_emplace(*pp_array, emplace_record, (void *) &A_record);
+    array_sized_emplace(*pp_array, emplace_record, (void *) &B_record);
+    array_sized_emplace(*pp_array, emplace_record, (void *) &C_record);
+
+    // array = [A, B, C]
     return;
 }
 
-void construct_A_addB_AB ( array **pp_array )
+void construct_sized_ABD_set2C_ABC ( array **pp_array )
 {
 
-    // Construct an [A] array 
-    construct_empty_addA_A(pp_array);
+    // Construct a sized [A, B, D] array
+    array_construct_sized_sync(pp_array, 3, sizeof(record), test_sync);
+    array_sized_add(*pp_array, &A_record);
+    array_sized_add(*pp_array, &B_record);
+    array_sized_add(*pp_array, &D_record);
 
-    // [A] -> add(B) -> [B]
-    array_add(*pp_array , B_element);
- 
-    // array = [A, B]
+    // [A, B, D] -> set(2, C) -> [A, B, C]
+    array_sized_set(*pp_array, 2, &C_record);
+
+    // array = [A, B, C]
     return;
 }
 
-void construct_AB_addC_ABC ( array **pp_array )
+void construct_sized_CBA_sortstable_ABC ( array **pp_array )
 {
 
-    // Construct an [A, B] array
-    construct_A_addB_AB(pp_array);
+    // Construct a sized [C, B, A] array
+    array_construct_sized_sync(pp_array, 3, sizeof(record), test_sync);
+    array_sized_add(*pp_array, &C_record);
+    array_sized_add(*pp_array, &B_record);
+    array_sized_add(*pp_array, &A_record);
 
-    // [A, B] -> add(C) -> [A, B, C]
-    array_add(*pp_array, C_element);
+    // [C, B, A] -> sort_stable() -> [A, B, C]
+    array_sized_sort_stable(*pp_array, compare_record, (void *) 0);
 
     // array = [A, B, C]
     return;
 }
 
-void construct_ABC_clear_empty ( array **pp_array )
+void construct_sorted_empty_addCAB_ABC ( array **pp_array )
 {
 
-    // Construct an [A, B, C] array
-    construct_AB_addC_ABC(pp_array);
+    // Construct an empty sorted array
+    array_construct_sorted(pp_array, 1, test_sync, compare_string, (void *) 0);
 
-    // [A, B, C] -> clear() -> []
-    array_clear(*pp_array);
+    // [] -> add(C) -> add(A) -> add(B) -> [A, B, C]
+    array_add(*pp_array, C_element);
+    array_add(*pp_array, A_element);
+    array_add(*pp_array, B_element);
 
-    // array = []
+    // array = [A, B, C]
     return;
 }
 
-void construct_AB_clear_empty ( array **pp_array )
+void construct_sized_sorted_empty_addCAB_ABC ( array **pp_array )
 {
 
-    // Construct an [A, B] array
-    construct_A_addB_AB(pp_array);
+    // Construct an empty sorted sized array
+    array_construct_sized_sorted(pp_array, 1, sizeof(record), test_sync, compare_record, (void *) 0);
 
-    // [A, B] -> clear() -> []
-    array_clear(*pp_array);
+    // [] -> sized add(C) -> add(A) -> add(B) -> [A, B, C]
+    array_sized_add(*pp_array, &C_record);
+    array_sized_add(*pp_array, &A_record);
+    array_sized_add(*pp_array, &B_record);
 
-    // array = []
+    // array = [A, B, C]
     return;
 }
 
-void construct_A_clear_empty ( array **pp_array )
+void construct_CAB_sort_ABC ( array **pp_array )
 {
 
-    // Construct an [A] array
-    construct_empty_addA_A(pp_array);
+    // Construct a [C, A, B] array
+    array_construct_sync(pp_array, 3, test_sync);
+    array_add(*pp_array, C_element);
+    array_add(*pp_array, A_element);
+    array_add(*pp_array, B_element);
 
-    // [A] -> clear() -> []
-    array_clear(*pp_array);
+    // [C, A, B] -> sort() -> [A, B, C]
+    array_sort(*pp_array, compare_string, (void *) 0);
 
-    // array = []
+    // array = [A, B, C]
     return;
 }
 
-void construct_empty_fromelementsABC_ABC ( array **pp_array )
+void construct_DADBCD_filternotD_ABC ( array **pp_array )
 {
 
-    // ... -> from_elements(A, B, C) -> [A, B, C]
-    array_from_elements(pp_array, (void **)ABC_elements);
-    
+    // Initialized data
+    array *p_array = 0;
+
+    // Construct a [D, A, D, B, C, D] array
+    array_construct_sync(&p_array, 6, test_sync);
+    array_add(p_array, D_element);
+    array_add(p_array, A_element);
+    array_add(p_array, D_element);
+    array_add(p_array, B_element);
+    array_add(p_array, C_element);
+    array_add(p_array, D_element);
+
+    // [D, A, D, B, C, D] -> filter(not D) -> [A, B, C]
+    array_filter(p_array, pp_array, is_not_D, (void *) 0, 2);
+
+    // Destroy the source
+    array_destroy(&p_array);
+
     // array = [A, B, C]
     return;
 }
 
-void construct_empty_fromelementsAB_AB ( array **pp_array )
+void construct_DDD_mapindex_ABC ( array **pp_array )
 {
 
-    // ... -> from_elements(A, B) -> [A, B]
-    array_from_elements(pp_array, (void **)AB_elements);
+    // Initialized data
+    array *p_array = 0;
 
-    // array = [A, B]
+    // Construct a [D, D, D] array
+    array_construct_sync(&p_array, 3, test_sync);
+    array_add(p_array, D_element);
+    array_add(p_array, D_element);
+    array_add(p_array, D_element);
+
+    // [D, D, D] -> map(index) -> [A, B, C]
+    array_map(p_array, pp_array, map_index, (void *) 0, 1);
+
+    // Destroy the source
+    array_destroy(&p_array);
+
+    // array = [A, B, C]
     return;
 }
 
-void construct_empty_fromelementsA_A ( array **pp_array )
+void construct_DADBCDA_pipelinenotDtake3_ABC ( array **pp_array )
 {
 
-    // ... -> from_elements(A) -> [A]
-    array_from_elements(pp_array, (void **)A_elements);
+    // Initialized data
+    array          *p_array    = 0;
+    array_pipeline *p_pipeline = 0;
+
+    // Construct a [D, A, D, B, C, D, A] array
+    array_construct_sync(&p_array, 7, test_sync);
+    array_add(p_array, D_element);
+    array_add(p_array, A_element);
+    array_add(p_array, D_element);
+    array_add(p_array, B_element);
+    array_add(p_array, C_element);
+    array_add(p_array, D_element);
+    array_add(p_array, A_element);
+
+    // [D, A, D, B, C, D, A] -> filter(not D) -> take(3) -> [A, B, C]
+    array_pipeline_construct(&p_pipeline, p_array);
+    array_pipeline_filter(p_pipeline, is_not_D, (void *) 0);
+    array_pipeline_take(p_pipeline, 3);
+    array_pipeline_collect(p_pipeline, pp_array);
+
+    // Destroy the pipeline and the source
+    array_pipeline_destroy(&p_pipeline);
+    array_destroy(&p_array);
 
-    // array = [A]
+    // array = [A, B, C]
     return;
 }
 
-void construct_empty_fromargumentsABC_ABC ( array **pp_array )
+void construct_sized_DABC_remove0_ABC ( array **pp_array )
 {
 
-    // ... -> from_arguments(A, B, C) -> [A, B, C]
-    array_from_arguments(pp_array, 3, 3, "A", "B", "C");
-    
+    // Construct a sized [D, A, B, C] array
+    array_construct_sized_sync(pp_array, 4, sizeof(record), test_sync);
+    array_sized_add(*pp_array, &D_record);
+    array_sized_add(*pp_array, &A_record);
+    array_sized_add(*pp_array, &B_record);
+    array_sized_add(*pp_array, &C_record);
+
+    // [D, A, B, C] -> remove(0) -> [A, B, C]
+    array_sized_remove(*pp_array, 0, (void *)0);
+
     // array = [A, B, C]
     return;
 }
 
-void construct_empty_fromargumentsAB_AB ( array **pp_array )
+int emplace_record ( void *const p_element, void *const p_parameter )
 {
 
-    // ... -> from_arguments(A, B) -> [A, B]
-    array_from_arguments(pp_array, 2, 2, "A", "B");
+    // Copy the record into the slot
+    memcpy(p_element, p_parameter, sizeof(record));
 
-    // array = [A, B]
-    return;
+    // Success
+    return 1;
 }
 
-void construct_empty_fromargumentsA_A ( array **pp_array )
+int sum_record ( const void *const p_value, size_t i )
 {
 
-    // ... -> from_arguments(A) -> [A]
-    array_from_arguments(pp_array, 1, 1, "A");
+    // Unused
+    (void) i;
 
-    // array = [A]
-    return;
+    // Accumulate
+    record_sum += ((const record *) p_value)->a;
+
+    // Success
+    return 1;
 }
 
-void construct_A_remove0_empty ( array **pp_array )
+int sum_index_parallel ( const void *const p_value, size_t index, void *const p_context )
 {
 
-    // Construct an [A] array
-    construct_empty_addA_A(pp_array);
-
-    // [A] -> remove(0) -> []
-    array_remove(*pp_array, 0, (void *)0);
+    // Accumulate
+    __atomic_fetch_add((size_t *) p_context, *(const size_t *) p_value, __ATOMIC_RELAXED);
 
-    // array = []
-    return;
+    // Success
+    return ( *(const size_t *) p_value == index );
 }
 
-void construct_AB_remove1_A ( array **pp_array )
+int fail_at_7_parallel ( const void *const p_value, size_t index, void *const p_context )
 {
 
-    // Construct an [A, B] array
-    construct_A_addB_AB(pp_array);
+    // Unused
+    (void) p_value;
 
-    // [A, B] -> remove(1) -> [A]
-    array_remove(*pp_array, 1, (void *)0);
+    // Count the visit
+    __atomic_fetch_add((size_t *) p_context, 1, __ATOMIC_RELAXED);
 
-    // array = []
-    return;
+    // Fail at index 7
+    return ( index != 7 );
 }
 
-void construct_ABC_remove2_AB ( array **pp_array )
+int nested_parallel ( const void *const p_value, size_t index, void *const p_context )
 {
 
-    // Construct an [A, B, C] array
-    construct_AB_addC_ABC(pp_array);
+    // Initialized data
+    size_t sum = 0;
 
-    // [A, B, C] -> remove(2) -> [A, B]
-    array_remove(*pp_array, 2, (void *)0);
+    // Unused
+    (void) p_value;
+    (void) index;
 
-    // array = []
-    return;
+    // Sum the array
+    if ( array_sized_foreach_parallel((array *) p_context, sum_index_parallel, &sum, 16) == 0 ) return 0;
+
+    // Success
+    return ( sum == 999 * 1000 / 2 );
 }
 
-void test_empty_array ( void (*array_constructor)(array **pp_array), char *name)
+int compare_string ( const void *const p_a, const void *const p_b, void *const p_context )
 {
 
-    // Formatting
-    log_info("Scenario: %s\n", name);
+    // Unused
+    (void) p_context;
 
-    // Test the add function
-    print_test(name, "array_add_A", test_add(array_constructor, A_element, one) );
-    print_test(name, "array_add_B", test_add(array_constructor, B_element, one) );
+    // Success
+    return strcmp(p_a, p_b);
+}
 
-    // Test the index function
-    print_test(name, "array_index0", test_index(array_constructor, 0, (void *)0, zero) );
-    print_test(name, "array_index1", test_index(array_constructor, 1, (void *)0, zero) );
+int compare_record ( const void *const p_a, const void *const p_b, void *const p_context )
+{
 
-    // Test the get function
-    print_test(name, "array_get", test_get(array_constructor, (void **)_elements, zero) );    
+    // Initialized data
+    long long a = ((const record *) p_a)->a,
+              b = ((const record *) p_b)->a;
 
-    // Test the count 
-    print_test(name, "array_get_count", test_get_count(array_constructor, 0, match) );
-    
-    // Test the remove function
-    print_test(name, "array_remove0", test_remove(array_constructor, (void *)0, 0, zero) );
+    // Unused
+    (void) p_context;
 
-    // Print the summary of this test
-    print_final_summary();
+    // Success
+    return ( a > b ) - ( a < b );
+}
 
-    // Done
-    return;
+int square_parallel ( const void *const p_value, size_t index, void *const p_result, void *const p_context )
+{
+
+    // Unused
+    (void) index;
+    (void) p_context;
+
+    // Square the element
+    *(size_t *) p_result = *(const size_t *) p_value * *(const size_t *) p_value;
+
+    // Success
+    return 1;
 }
 
-void test_one_element_array ( void (*array_constructor)(array **pp_array), char *name, void **values )
+int is_even_parallel ( const void *const p_value, size_t index, void *const p_context )
 {
 
-    // Formatting
-    log_info("SCENARIO: %s\n", name);
+    // Unused
+    (void) index;
+    (void) p_context;
 
-    // Test the add function
-    print_test(name, "array_add_D", test_add(array_constructor, D_element, one) );
-    
-    // Test the get function
-    print_test(name, "array_get"      , test_get(array_constructor, values, zero) );
-    print_test(name, "array_get_count", test_get_count(array_constructor, 1, match) );
+    // Success
+    return ( *(const size_t *) p_value % 2 == 0 );
+}
 
-    // Test the size function
-    print_test(name, "array_size", test_size(array_constructor, 1, match));
-    
-    // Test the index function
-    print_test(name, "array_index0", test_index(array_constructor, 0, values[0], match) );
-    print_test(name, "array_index1", test_index(array_constructor, 1, (void *)0, zero) );
+int sum_parallel ( void *const p_accumulator, const void *const p_value, size_t index, void *const p_context )
+{
 
-    // Test the remove function
-    print_test(name, "array_remove0", test_remove(array_constructor, values[0], 0, match) );
-    print_test(name, "array_remove1", test_remove(array_constructor, (void *)0, 1, zero) );
+    // Unused
+    (void) index;
+    (void) p_context;
 
-    // Print the summary of this test   
-    print_final_summary();
-    
-    // Done
-    return;
+    // Accumulate
+    *(size_t *) p_accumulator += *(const size_t *) p_value;
+
+    // Success
+    return 1;
 }
 
-void test_two_element_array ( void (*array_constructor)(array **pp_array), char *name, void **values )
+int combine_sum ( void *const p_accumulator, const void *const p_other, void *const p_context )
 {
-    
-    // Formatting
-    log_info("SCENARIO: %s\n", name);
 
-    // Test the add function
-    print_test(name, "array_add_D", test_add(array_constructor, D_element, one) );
-    
-    // Test the get function
-    print_test(name, "array_get"      , test_get(array_constructor, values, zero) );
-    print_test(name, "array_get_count", test_get_count(array_constructor, 2, match) );
+    // Unused
+    (void) p_context;
 
-    // Test the size function
-    print_test(name, "array_size", test_size(array_constructor, 2, match));
-    
-    // Test the index function
-    print_test(name, "array_index0", test_index(array_constructor, 0, values[0], match) );
-    print_test(name, "array_index1", test_index(array_constructor, 1, values[1], match) );  
-    print_test(name, "array_index2", test_index(array_constructor, 2, (void *)0, zero) );  
+    // Accumulate
+    *(size_t *) p_accumulator += *(const size_t *) p_other;
 
-    // Test the remove function    
-    print_test(name, "array_remove0", test_remove(array_constructor, values[0], 0, match) );
-    print_test(name, "array_remove1", test_remove(array_constructor, values[1], 1, match) );
-    print_test(name, "array_remove2", test_remove(array_constructor, (void *)0, 2, zero) );
+    // Success
+    return 1;
+}
 
-    // Print the summary of this test
-    print_final_summary();
-    
-    // Done
-    return;
+int is_not_D ( const void *const p_value, size_t index, void *const p_context )
+{
+
+    // Unused
+    (void) index;
+    (void) p_context;
+
+    // Success
+    return ( strcmp(p_value, D_element) != 0 );
 }
 
-void test_three_element_array ( void (*array_constructor)(array **pp_array), char *name, void **values )
+int map_index ( const void *const p_value, size_t index, void *const p_result, void *const p_context )
 {
 
-    // Formatting
-    log_info("SCENARIO: %s\n", name);
+    // Unused
+    (void) p_value;
+    (void) p_context;
 
-    // Test the add function
-    print_test(name, "array_add_D", test_add(array_constructor, D_element, one) );
-    
-    // Test the get function
-    print_test(name, "array_get", test_get(array_constructor, values, zero) );
-    print_test(name, "array_get_count", test_get_count(array_constructor, 3, match) );
+    // Store the element at the index
+    *(void **) p_result = ( index < 3 ) ? ABC_elements[index] : (void *) 0;
 
-    // Test the size function
-    print_test(name, "array_size", test_size(array_constructor, 3, match));
-    
-    // Test the index function
-    print_test(name, "array_index0"   , test_index(array_constructor, 0, values[0], match) );
-    print_test(name, "array_index1"   , test_index(array_constructor, 1, values[1], match) );  
-    print_test(name, "array_index2"   , test_index(array_constructor, 2, values[2], match) );  
-    print_test(name, "array_index3"   , test_index(array_constructor, 3, (void *)0, zero) );  
+    // Fail at index 7
+    return ( index != 7 );
+}
 
-    // Test the remove function
-    print_test(name, "array_remove0"  , test_remove(array_constructor, values[0], 0, match) );
-    print_test(name, "array_remove1"  , test_remove(array_constructor, values[1], 1, match) );
-    print_test(name, "array_remove2"  , test_remove(array_constructor, values[2], 2, match) );
-    print_test(name, "array_remove3"  , test_remove(array_constructor, (void *)0, 3, zero) );
+int is_even_visit ( const void *const p_value, size_t index, void *const p_context )
+{
 
-    // Print the summary of this test
-    print_final_summary();
-    
-    // Done
-    return;
+    // Unused
+    (void) index;
+
+    // Count the visit
+    (*(size_t *) p_context)++;
+
+    // Success
+    return ( *(const size_t *) p_value % 2 == 0 );
+}
+
+int is_square_of_index ( const void *const p_value, size_t index, void *const p_context )
+{
+
+    // Count the element
+    (*(size_t *) p_context)++;
+
+    // Success
+    return ( *(const size_t *) p_value == index * index );
 }
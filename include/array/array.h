@@ -14,6 +14,8 @@
 #include <stdlib.h>
 #include <stdarg.h>
 #include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
 #include <string.h>
 
 // sync submodule
@@ -26,11 +28,75 @@
     #define DLLEXPORT
 #endif
 
-// Memory management macro
+// Memory management macros
 #ifndef ARRAY_REALLOC
     #define ARRAY_REALLOC(p, sz) realloc(p,sz)
+
+    // Bytes the allocator really reserved for a block from ARRAY_REALLOC
+    #ifndef ARRAY_USABLE_SIZE
+        #if defined _WIN64
+            #include <malloc.h>
+            #define ARRAY_USABLE_SIZE(p) _msize(p)
+        #elif defined __APPLE__
+            #include <malloc/malloc.h>
+            #define ARRAY_USABLE_SIZE(p) malloc_size(p)
+        #elif defined __GLIBC__
+            #include <malloc.h>
+            #define ARRAY_USABLE_SIZE(p) malloc_usable_size(p)
+        #endif
+    #endif
+#endif
+
+// Unknown usable size. Define ARRAY_USABLE_SIZE alongside a custom ARRAY_REALLOC
+#ifndef ARRAY_USABLE_SIZE
+    #define ARRAY_USABLE_SIZE(p) ((size_t) 0)
+#endif
+
+// Inline storage. Arrays whose elements fit in this many bytes skip the second allocation,
+// unless they are constructed with array_construct_inline
+#ifndef ARRAY_INLINE_BYTES
+    #define ARRAY_INLINE_BYTES 64
+#endif
+
+// Parallel iteration. Elements claimed at a time by a worker, unless the caller chooses
+#ifndef ARRAY_PARALLEL_GRAIN
+    #define ARRAY_PARALLEL_GRAIN 1024
+#endif
+
+// Sorting. Arrays with at least this many elements sort in parallel
+#ifndef ARRAY_SORT_PARALLEL_THRESHOLD
+    #define ARRAY_SORT_PARALLEL_THRESHOLD 65536
+#endif
+
+// Threads that run parallel jobs, including the caller. Zero uses one per processor
+#ifndef ARRAY_PARALLEL_THREADS
+    #define ARRAY_PARALLEL_THREADS 0
 #endif
 
+// Enumeration definitions
+/** !
+ *  @brief Synchronization strategies for an array
+ */
+enum array_sync_e
+{
+    ARRAY_SYNC_MUTEX   = 0, // Every operation locks one mutex
+    ARRAY_SYNC_RWLOCK  = 1, // Readers share a reader-writer lock, writers lock it exclusively
+    ARRAY_SYNC_SEQLOCK = 2, // array_index, array_size and array_is_empty read without locking, and retry if a writer raced
+    ARRAY_SYNC_NONE    = 3  // No lock. The array must be confined to one thread at a time
+};
+
+/** !
+ *  @brief Growth policies for an array. One policy may be combined with 
+ *         ARRAY_GROWTH_USABLE_SIZE
+ */
+enum array_growth_e
+{
+    ARRAY_GROWTH_DOUBLE      = 0,   // Double the capacity
+    ARRAY_GROWTH_HALF        = 1,   // Grow the capacity by half
+    ARRAY_GROWTH_FIXED       = 2,   // Grow the capacity by a fixed quantity of elements
+    ARRAY_GROWTH_CALLBACK    = 3,   // Ask a function for the new capacity
+    ARRAY_GROWTH_USABLE_SIZE = 0x10 // Round the capacity up to the bytes the allocator really reserved
+};
 
 // Type definitions
 /** !
@@ -38,11 +104,103 @@
  */
 typedef struct array_s array;
 
+/** !
+ *  @brief A function that allocates, reallocates or frees memory, like realloc, with a context
+ */
+typedef void *(fn_array_realloc)(void *p_context, void *p_memory, size_t size);
+
+/** !
+ *  @brief A function that frees memory from a fn_array_realloc, with a context
+ */
+typedef void (fn_array_free)(void *p_context, void *p_memory);
+
+/** !
+ *  @brief The type definition of an array allocator
+ */
+typedef struct array_allocator_s array_allocator;
+
+/** !
+ *  @brief The type definition of an arena of arrays
+ */
+typedef struct array_arena_s array_arena;
+
+/** !
+ *  @brief The type definition of a pool of released arrays
+ */
+typedef struct array_pool_s array_pool;
+
+/** !
+ *  @brief The type definition of a lazy pipeline over an array
+ */
+typedef struct array_pipeline_s array_pipeline;
+
+/** !
+ *  @brief The type definition of an array synchronization strategy
+ */
+typedef enum array_sync_e array_sync;
+
+/** !
+ *  @brief The type definition of an array growth policy
+ */
+typedef enum array_growth_e array_growth;
+
+/** !
+ *  @brief A function that returns the new capacity of an array. The result must be at least required
+ */
+typedef size_t (fn_array_growth)(size_t max, size_t required);
+
+/** !
+ *  @brief A function that constructs an element in place. Return 0 to cancel the element
+ */
+typedef int (fn_array_emplace)(void *const p_element, void *const p_parameter);
+
 /** !
  *  @brief A function to be called for each element in an array
  */
 typedef int (fn_array_foreach_i)(const void *const value, size_t index);
 
+/** !
+ *  @brief A function to be called for each element in an array, from any thread. Return 0 on error
+ */
+typedef int (fn_array_foreach_parallel)(const void *const value, size_t index, void *const p_context);
+
+/** !
+ *  @brief A function that orders two elements. Return negative if a comes first, positive if b comes first, else 0
+ */
+typedef int (fn_array_compare)(const void *const p_a, const void *const p_b, void *const p_context);
+
+/** !
+ *  @brief A function that writes the element of a new array computed from an element of another, from any thread. Return 0 on error
+ */
+typedef int (fn_array_map)(const void *const value, size_t index, void *const p_result, void *const p_context);
+
+/** !
+ *  @brief A function that tests an element, from any thread. Return nonzero to keep it
+ */
+typedef int (fn_array_filter)(const void *const value, size_t index, void *const p_context);
+
+/** !
+ *  @brief A function that folds an element into an accumulator, from any thread. Return 0 on error
+ */
+typedef int (fn_array_reduce)(void *const p_accumulator, const void *const value, size_t index, void *const p_context);
+
+/** !
+ *  @brief A function that folds the accumulator of later elements into the accumulator of earlier ones. Return 0 on error
+ */
+typedef int (fn_array_combine)(void *const p_accumulator, const void *const p_other, void *const p_context);
+
+// Structure definitions
+/** !
+ *  @brief An allocator for an array and its storage. A null pfn_realloc uses
+ *         ARRAY_REALLOC. A null pfn_free frees by calling pfn_realloc with size 0
+ */
+struct array_allocator_s
+{
+    fn_array_realloc *pfn_realloc; // Allocates, reallocates and frees memory
+    fn_array_free    *pfn_free;    // Frees memory
+    void             *p_context;   // Passed to pfn_realloc and pfn_free
+};
+
 // Initializer
 /** !
  * This gets called at runtime before main. 
@@ -65,6 +223,20 @@ DLLEXPORT void array_init ( void ) __attribute__((constructor));
  */
 DLLEXPORT int array_create ( array **pp_array );
 
+/** !
+ *  Allocate memory for an array from an allocator. The array's storage comes
+ *  from the same allocator
+ *
+ * @param pp_array    return
+ * @param p_allocator the allocator, or null for ARRAY_REALLOC
+ *
+ * @sa array_create
+ * @sa array_construct_allocator
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int array_create_allocator ( array **const pp_array, const array_allocator *const p_allocator );
+
 // Constructors
 /** !
  *  Construct an array with a specific size
@@ -79,6 +251,133 @@ DLLEXPORT int array_create ( array **pp_array );
  */
 DLLEXPORT int array_construct ( array **pp_array, size_t size );
 
+/** !
+ *  Construct an array with a specific size and synchronization strategy. 
+ *  With ARRAY_SYNC_RWLOCK, array_index, array_get, array_slice, array_is_empty 
+ *  and array_foreach_i run in parallel; array_add, array_set, array_remove, 
+ *  array_clear and array_free_clear run alone. With ARRAY_SYNC_SEQLOCK, 
+ *  array_index, array_size and array_is_empty never write shared memory. 
+ *  Storage replaced by a growing array is kept until array_destroy, so a 
+ *  racing reader never reads freed memory. To bound that storage, heap 
+ *  storage never shrinks, and grows at least twice over. With ARRAY_SYNC_NONE, no lock is 
+ *  created or taken, and the caller is responsible for synchronization.
+ *
+ * @param pp_array return
+ * @param size     number of elements in an array
+ * @param sync     the synchronization strategy
+ *
+ * @sa array_construct
+ * @sa array_destroy
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int array_construct_sync ( array **pp_array, size_t size, array_sync sync );
+
+/** !
+ *  Construct an array that stores elements of element_size bytes by value, 
+ *  back to back. Access its elements with the array_sized_* functions. 
+ *  Functions that take or return element pointers, like array_add and 
+ *  array_index, are for arrays of pointers only, and fail unless 
+ *  element_size is sizeof(void *)
+ *
+ * @param pp_array     return
+ * @param size         number of elements in an array
+ * @param element_size bytes in each element
+ *
+ * @sa array_construct_sized_sync
+ * @sa array_destroy
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int array_construct_sized ( array **const pp_array, size_t size, size_t element_size );
+
+/** !
+ *  Construct a sized array with a specific synchronization strategy
+ *
+ * @param pp_array     return
+ * @param size         number of elements in an array
+ * @param element_size bytes in each element
+ * @param sync         the synchronization strategy
+ *
+ * @sa array_construct_sized
+ * @sa array_construct_sync
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int array_construct_sized_sync ( array **const pp_array, size_t size, size_t element_size, array_sync sync );
+
+/** !
+ *  Construct a sized array in one allocation, with room for size elements 
+ *  directly after the header. The count, the capacity and the first 
+ *  elements share a cache line. The array still grows past size, by 
+ *  spilling its elements to the heap
+ *
+ * @param pp_array     return
+ * @param size         number of elements in an array
+ * @param element_size bytes in each element. Use sizeof(void *) for an array of pointers
+ * @param sync         the synchronization strategy
+ *
+ * @sa array_construct_sized_sync
+ * @sa array_destroy
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int array_construct_inline ( array **const pp_array, size_t size, size_t element_size, array_sync sync );
+
+/** !
+ *  Construct a sized array whose header and storage come from an allocator.
+ *  The allocator is copied into the array, and its context must outlive it.
+ *  ARRAY_GROWTH_USABLE_SIZE has no effect on these arrays
+ *
+ * @param pp_array     return
+ * @param size         number of elements in an array
+ * @param element_size bytes in each element. Use sizeof(void *) for an array of pointers
+ * @param sync         the synchronization strategy
+ * @param p_allocator  the allocator, or null for ARRAY_REALLOC
+ *
+ * @sa array_create_allocator
+ * @sa array_destroy
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int array_construct_allocator ( array **const pp_array, size_t size, size_t element_size, array_sync sync, const array_allocator *const p_allocator );
+
+/** !
+ *  Construct a sorted array of pointers. array_add and array_add_many insert
+ *  each value at its lower bound, so the values stay ordered by pfn_compare. 
+ *  Functions that would reorder the array, like array_insert, array_set, 
+ *  array_remove_unordered and array_sort, fail on a sorted array
+ *
+ * @param pp_array    return
+ * @param size        number of elements in an array
+ * @param sync        the synchronization strategy
+ * @param pfn_compare orders two values
+ * @param p_context   passed to pfn_compare
+ *
+ * @sa array_lower_bound
+ * @sa array_find_sorted
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int array_construct_sorted ( array **const pp_array, size_t size, array_sync sync, fn_array_compare *pfn_compare, void *const p_context );
+
+/** !
+ *  Construct a sorted sized array. array_sized_add inserts each element at 
+ *  its lower bound. pfn_compare receives pointers to elements
+ *
+ * @param pp_array     return
+ * @param size         number of elements in an array
+ * @param element_size bytes in each element
+ * @param sync         the synchronization strategy
+ * @param pfn_compare  orders two elements
+ * @param p_context    passed to pfn_compare
+ *
+ * @sa array_construct_sorted
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int array_construct_sized_sorted ( array **const pp_array, size_t size, size_t element_size, array_sync sync, fn_array_compare *pfn_compare, void *const p_context );
+
 /** !
  *  Construct an array from an array of elements
  *
@@ -153,6 +452,40 @@ DLLEXPORT int array_get ( array * const p_array, void ** const pp_elements, size
 */
 DLLEXPORT int array_slice ( array *const p_array, void *pp_elements[], signed lower_bound, signed upper_bound );
 
+/** !
+ *  Borrow the elements of an array without copying them. The array stays 
+ *  locked for reading until array_view_release, so its storage can not be 
+ *  moved or freed while the view is live. Writers wait for the view to be 
+ *  released; with ARRAY_SYNC_MUTEX and ARRAY_SYNC_SEQLOCK, so do other 
+ *  readers. Do not modify the array from the thread holding the view. With
+ *  ARRAY_SYNC_MUTEX and ARRAY_SYNC_SEQLOCK the lock is exclusive, so that 
+ *  thread must not read the array either, with array_get, array_slice, 
+ *  array_foreach_i, the sized reads or any other function that locks it, 
+ *  until the view is released. array_size, and with ARRAY_SYNC_SEQLOCK 
+ *  array_index and array_is_empty, do not lock the array
+ *
+ * @param p_array      array
+ * @param ppp_elements return
+ * @param p_count      return, the quantity of elements in the view
+ *
+ * @sa array_view_release
+ * @sa array_get
+ *
+ * @return 1 on success, 0 on error 
+ */
+DLLEXPORT int array_view_acquire ( array *const p_array, const void *const **const ppp_elements, size_t *const p_count );
+
+/** !
+ *  Release a view of an array
+ *
+ * @param p_array array
+ *
+ * @sa array_view_acquire
+ *
+ * @return 1 on success, 0 on error 
+ */
+DLLEXPORT int array_view_release ( array *const p_array );
+
 /** !
  *  Is an array empty?
  * 
@@ -171,6 +504,18 @@ DLLEXPORT bool array_is_empty ( array *const p_array );
  */
 DLLEXPORT size_t array_size ( array *const p_array );
 
+/** !
+ *  Get the quantity of elements an array can hold before it grows
+ * 
+ * @param p_array an array
+ * 
+ * @sa array_reserve
+ * @sa array_shrink_to_fit
+ * 
+ * @return capacity of array
+ */
+DLLEXPORT size_t array_capacity ( array *const p_array );
+
 // Mutators
 /** !
  *  Add an element to the end of an array. 
@@ -182,6 +527,52 @@ DLLEXPORT size_t array_size ( array *const p_array );
  */
 DLLEXPORT int array_add ( array *const p_array, void *const p_element );
 
+/** !
+ *  Add many elements to the end of an array. The array is locked once,
+ *  and grows at most once.
+ *
+ * @param p_array     array
+ * @param pp_elements the elements
+ * @param count       the quantity of elements
+ *
+ * @sa array_add
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int array_add_many ( array *const p_array, void *const *const pp_elements, size_t count );
+
+/** !
+ *  Insert an element before the element at an index. A positive index may 
+ *  equal the size of the array, which appends the element. If index is 
+ *  negative, index = size - |index|, such that [A,B,C] insert(-1, X) -> [A,B,X,C]
+ *
+ * @param p_array   the array
+ * @param index     signed index
+ * @param p_element the element
+ *
+ * @sa array_add
+ * @sa array_insert_many
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int array_insert ( array *const p_array, signed index, void *const p_element );
+
+/** !
+ *  Insert many elements before the element at an index, as in array_insert. 
+ *  The array grows at most once, and the tail is shifted with one memmove.
+ *
+ * @param p_array     the array
+ * @param index       signed index
+ * @param pp_elements the elements
+ * @param count       the quantity of elements
+ *
+ * @sa array_insert
+ * @sa array_add_many
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int array_insert_many ( array *const p_array, signed index, void *const *const pp_elements, size_t count );
+
 /** !
  *  Update an array element at an index
  *
@@ -209,6 +600,114 @@ DLLEXPORT int array_set ( array *const p_array, signed index, void *const p_valu
  */
 DLLEXPORT int array_remove ( array *const p_array, signed index, void **const pp_value );
 
+/** !
+ *  Remove the elements from lower_bound to upper_bound, inclusive, as in 
+ *  array_slice. The gap is closed with one memmove, under one lock.
+ *
+ * @param p_array     the array
+ * @param lower_bound the index of the first removed element
+ * @param upper_bound the index of the last removed element
+ * @param pp_values   return, upper_bound - lower_bound + 1 elements. May be null
+ *
+ * @sa array_remove
+ * @sa array_slice
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int array_remove_range ( array *const p_array, signed lower_bound, signed upper_bound, void **const pp_values );
+
+/** !
+ *  Remove an element from an array in constant time, by moving the last 
+ *  element into its place. The order of the array is not preserved. If 
+ *  index is negative, index = size - |index|
+ *
+ * @param p_array  the array
+ * @param index    signed index
+ * @param pp_value return
+ *
+ * @sa array_remove
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int array_remove_unordered ( array *const p_array, signed index, void **const pp_value );
+
+/** !
+ *  Remove many elements from an array, moving elements from the end of the 
+ *  array into their places. Every index refers to the array before any 
+ *  removal. If any index is out of bounds, or two indices refer to the same
+ *  element, nothing is removed.
+ *
+ * @param p_array   the array
+ * @param p_indices the signed indices of the removed elements
+ * @param count     the quantity of indices
+ * @param pp_values return, the removed elements, in the order of p_indices. May be null
+ *
+ * @sa array_remove_unordered
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int array_remove_unordered_many ( array *const p_array, const signed *const p_indices, size_t count, void **const pp_values );
+
+/** !
+ *  Set how an array grows when it runs out of room. The heap storage of 
+ *  sequence locked arrays grows at least twice over, whatever the policy
+ *
+ * @param p_array   the array
+ * @param growth    an array_growth policy, optionally OR'd with ARRAY_GROWTH_USABLE_SIZE
+ * @param increment quantity of elements to grow by, for ARRAY_GROWTH_FIXED
+ * @param pfn_growth the function to call, for ARRAY_GROWTH_CALLBACK
+ *
+ * @sa array_reserve
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int array_growth_set ( array *const p_array, array_growth growth, size_t increment, fn_array_growth *pfn_growth );
+
+/** !
+ *  Shrink an array automatically when removals leave it mostly empty. When
+ *  the count falls below threshold times the capacity, the capacity shrinks
+ *  to twice the count, and never below min_capacity. Arrays do not shrink
+ *  by default. Sequence locked arrays never shrink automatically
+ *
+ * @param p_array      the array
+ * @param threshold    fraction of the capacity in [0, 0.5). Zero never shrinks
+ * @param min_capacity the smallest capacity to shrink to
+ *
+ * @sa array_shrink_to_fit
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int array_shrink_policy_set ( array *const p_array, double threshold, size_t min_capacity );
+
+/** !
+ *  Grow an array so it can hold at least capacity elements without 
+ *  reallocating. Never shrinks the array. With ARRAY_SYNC_SEQLOCK, heap 
+ *  storage grows at least twice over
+ *
+ * @param p_array  the array
+ * @param capacity the quantity of elements
+ *
+ * @sa array_capacity
+ * @sa array_shrink_to_fit
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int array_reserve ( array *const p_array, size_t capacity );
+
+/** !
+ *  Shrink the capacity of an array to its size, or to one element if it is
+ *  empty. Has no effect on the heap storage of ARRAY_SYNC_SEQLOCK arrays, 
+ *  which never shrinks
+ *
+ * @param p_array the array
+ *
+ * @sa array_capacity
+ * @sa array_reserve
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int array_shrink_to_fit ( array *const p_array );
+
 /** !
  *  Clear all elements in an array
  *
@@ -241,6 +740,332 @@ DLLEXPORT int array_free_clear ( array *const p_array, void (*const free_fun_ptr
  */
 DLLEXPORT int array_foreach_i ( array *const p_array, fn_array_foreach_i *pfn_array_foreach_i );
 
+/** !
+ * Call function on every element in an array, in parallel. The elements are
+ * split across a pool of worker threads, started on first use with one per 
+ * processor, and the calling thread. Workers that run out of elements steal
+ * from the others. The array stays locked throughout, so function must not 
+ * modify it. With ARRAY_SYNC_MUTEX and ARRAY_SYNC_SEQLOCK that lock is 
+ * exclusive, so function must not call any array function on p_array, and
+ * reads elements through value alone. Calls made from inside function run
+ * serially
+ *
+ * @param p_array     the array
+ * @param pfn_foreach the function
+ * @param p_context   passed to pfn_foreach
+ * @param grain       elements claimed at a time, or 0 for ARRAY_PARALLEL_GRAIN
+ * 
+ * @return 1 if every call returned nonzero, 0 on error
+ */
+DLLEXPORT int array_foreach_parallel ( array *const p_array, fn_array_foreach_parallel *pfn_foreach, void *const p_context, size_t grain );
+
+// Transforms
+/** !
+ * Construct a new array of pointers from every element in an array, in 
+ * parallel. pfn_map receives each value and a pointer to the slot of its 
+ * result, which it must write. The new array is sized exactly, and has the 
+ * synchronization strategy of the source. The source is locked as in 
+ * array_foreach_parallel, so pfn_map must not call any array function on 
+ * p_array under ARRAY_SYNC_MUTEX or ARRAY_SYNC_SEQLOCK
+ *
+ * @param p_array   the array
+ * @param pp_result return
+ * @param pfn_map   computes each element
+ * @param p_context passed to pfn_map
+ * @param grain     elements claimed at a time, or 0 for ARRAY_PARALLEL_GRAIN
+ *
+ * @sa array_foreach_parallel
+ *
+ * @return 1 if every call returned nonzero, 0 on error
+ */
+DLLEXPORT int array_map ( array *const p_array, array **const pp_result, fn_array_map *pfn_map, void *const p_context, size_t grain );
+
+/** !
+ * Construct a new array from the elements of an array that pass a test, in 
+ * parallel and in order. Each chunk of grain elements counts the elements it
+ * keeps, and a prefix sum of the counts places each chunk in the new array,
+ * which is sized exactly. The source is locked as in array_foreach_parallel,
+ * so pfn_filter must not call any array function on p_array under 
+ * ARRAY_SYNC_MUTEX or ARRAY_SYNC_SEQLOCK
+ *
+ * @param p_array    the array
+ * @param pp_result  return
+ * @param pfn_filter tests each element
+ * @param p_context  passed to pfn_filter
+ * @param grain      elements in each chunk, or 0 for ARRAY_PARALLEL_GRAIN
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int array_filter ( array *const p_array, array **const pp_result, fn_array_filter *pfn_filter, void *const p_context, size_t grain );
+
+/** !
+ * Fold every element in an array into one result, in parallel. Each chunk of
+ * grain elements folds into its own copy of the identity with pfn_reduce, and
+ * the copies are combined in order with pfn_combine, so the result does not
+ * depend on the quantity of threads. The array is locked as in 
+ * array_foreach_parallel, so neither function may call any array function 
+ * on p_array under ARRAY_SYNC_MUTEX or ARRAY_SYNC_SEQLOCK
+ *
+ * @param p_array     the array
+ * @param p_result    the identity on entry, and the result on success
+ * @param result_size bytes in the result
+ * @param pfn_reduce  folds an element into an accumulator
+ * @param pfn_combine folds an accumulator into another
+ * @param p_context   passed to pfn_reduce and pfn_combine
+ * @param grain       elements in each chunk, or 0 for ARRAY_PARALLEL_GRAIN
+ *
+ * @return 1 if every call returned nonzero, 0 on error
+ */
+DLLEXPORT int array_reduce ( array *const p_array, void *const p_result, size_t result_size, fn_array_reduce *pfn_reduce, fn_array_combine *pfn_combine, void *const p_context, size_t grain );
+
+// Sorting
+/** !
+ * Sort an array in place with introsort. pfn_compare receives the values 
+ * stored in the array. The array is locked exclusively throughout, and 
+ * arrays of at least ARRAY_SORT_PARALLEL_THRESHOLD elements sort in parallel,
+ * calling pfn_compare from several threads
+ *
+ * @param p_array     the array
+ * @param pfn_compare orders two values
+ * @param p_context   passed to pfn_compare
+ *
+ * @sa array_sort_stable
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int array_sort ( array *const p_array, fn_array_compare *pfn_compare, void *const p_context );
+
+/** !
+ * Sort an array in place with merge sort, keeping equal values in order. 
+ * Needs scratch memory as large as the elements
+ *
+ * @param p_array     the array
+ * @param pfn_compare orders two values
+ * @param p_context   passed to pfn_compare
+ *
+ * @sa array_sort
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int array_sort_stable ( array *const p_array, fn_array_compare *pfn_compare, void *const p_context );
+
+// Sorted arrays
+/** !
+ * Find the first element of a sorted array that does not order before a key,
+ * with a branchless binary search. pfn_compare receives each element first, 
+ * and the key second. For arrays of pointers the key is a value, like the 
+ * values passed to array_add; for sized arrays it points to the key
+ *
+ * @param p_array the sorted array
+ * @param p_key   the key
+ * @param p_index return, the index of the element, or the size of the array if there is none
+ *
+ * @sa array_construct_sorted
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int array_lower_bound ( array *const p_array, const void *const p_key, size_t *const p_index );
+
+/** !
+ * Find an element of a sorted array equal to a key
+ *
+ * @param p_array the sorted array
+ * @param p_key   the key
+ * @param p_index return, the index of the first equal element. May be null
+ *
+ * @sa array_lower_bound
+ *
+ * @return 1 if an element equals the key, 0 if none does, or on error
+ */
+DLLEXPORT int array_find_sorted ( array *const p_array, const void *const p_key, size_t *const p_index );
+
+/** !
+ * Freeze a sorted array for searching. A copy of the elements is laid out in
+ * Eytzinger order, the order of a breadth first walk of a balanced search 
+ * tree. array_lower_bound and array_find_sorted search the copy with 
+ * prefetching, and return the same indices, until the next write to the 
+ * array makes the copy stale. Stale copies are ignored, and kept until the 
+ * array is frozen again, thawed or destroyed
+ *
+ * @param p_array the sorted array
+ *
+ * @sa array_thaw
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int array_freeze ( array *const p_array );
+
+/** !
+ * Free the copy made by array_freeze
+ *
+ * @param p_array the array
+ *
+ * @sa array_freeze
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int array_thaw ( array *const p_array );
+
+// Sized arrays
+/** !
+ * Copy an element to the end of a sized array
+ *
+ * @param p_array   the array
+ * @param p_element pointer to element_size bytes
+ *
+ * @sa array_sized_emplace
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int array_sized_add ( array *const p_array, const void *const p_element );
+
+/** !
+ * Construct an element in place at the end of a sized array. The slot is 
+ * zeroed before pfn_emplace is called, and the array is locked throughout
+ *
+ * @param p_array     the array
+ * @param pfn_emplace the function that constructs the element
+ * @param p_parameter passed to pfn_emplace
+ *
+ * @sa array_sized_add
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int array_sized_emplace ( array *const p_array, fn_array_emplace *pfn_emplace, void *const p_parameter );
+
+/** !
+ * Copy an element out of a sized array. Negative indices count from the end
+ *
+ * @param p_array the array
+ * @param index   the index of the element
+ * @param p_value return, element_size bytes
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int array_sized_index ( array *const p_array, signed index, void *const p_value );
+
+/** !
+ * Overwrite an element of a sized array. Negative indices count from the end
+ *
+ * @param p_array the array
+ * @param index   the index of the element
+ * @param p_value pointer to element_size bytes
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int array_sized_set ( array *const p_array, signed index, const void *const p_value );
+
+/** !
+ * Remove an element from a sized array, preserving the order of the rest
+ *
+ * @param p_array the array
+ * @param index   the index of the element
+ * @param p_value return, element_size bytes. May be null
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int array_sized_remove ( array *const p_array, signed index, void *const p_value );
+
+/** !
+ * Call function on a pointer to every element in a sized array
+ *
+ * @param p_array             the array
+ * @param pfn_array_foreach_i the function
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int array_sized_foreach_i ( array *const p_array, fn_array_foreach_i *pfn_array_foreach_i );
+
+/** !
+ * Call function on a pointer to every element in a sized array, in parallel
+ *
+ * @param p_array     the array
+ * @param pfn_foreach the function
+ * @param p_context   passed to pfn_foreach
+ * @param grain       elements claimed at a time, or 0 for ARRAY_PARALLEL_GRAIN
+ *
+ * @sa array_foreach_parallel
+ *
+ * @return 1 if every call returned nonzero, 0 on error
+ */
+DLLEXPORT int array_sized_foreach_parallel ( array *const p_array, fn_array_foreach_parallel *pfn_foreach, void *const p_context, size_t grain );
+
+/** !
+ * Construct a new sized array from a pointer to every element in a sized 
+ * array, in parallel
+ *
+ * @param p_array      the array
+ * @param pp_result    return
+ * @param element_size bytes in each element of the new array
+ * @param pfn_map      computes each element
+ * @param p_context    passed to pfn_map
+ * @param grain        elements claimed at a time, or 0 for ARRAY_PARALLEL_GRAIN
+ *
+ * @sa array_map
+ *
+ * @return 1 if every call returned nonzero, 0 on error
+ */
+DLLEXPORT int array_sized_map ( array *const p_array, array **const pp_result, size_t element_size, fn_array_map *pfn_map, void *const p_context, size_t grain );
+
+/** !
+ * Construct a new sized array from the elements of a sized array that pass a
+ * test, in parallel and in order. pfn_filter receives pointers to elements
+ *
+ * @param p_array    the array
+ * @param pp_result  return
+ * @param pfn_filter tests each element
+ * @param p_context  passed to pfn_filter
+ * @param grain      elements in each chunk, or 0 for ARRAY_PARALLEL_GRAIN
+ *
+ * @sa array_filter
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int array_sized_filter ( array *const p_array, array **const pp_result, fn_array_filter *pfn_filter, void *const p_context, size_t grain );
+
+/** !
+ * Fold a pointer to every element in a sized array into one result, in parallel
+ *
+ * @param p_array     the array
+ * @param p_result    the identity on entry, and the result on success
+ * @param result_size bytes in the result
+ * @param pfn_reduce  folds an element into an accumulator
+ * @param pfn_combine folds an accumulator into another
+ * @param p_context   passed to pfn_reduce and pfn_combine
+ * @param grain       elements in each chunk, or 0 for ARRAY_PARALLEL_GRAIN
+ *
+ * @sa array_reduce
+ *
+ * @return 1 if every call returned nonzero, 0 on error
+ */
+DLLEXPORT int array_sized_reduce ( array *const p_array, void *const p_result, size_t result_size, fn_array_reduce *pfn_reduce, fn_array_combine *pfn_combine, void *const p_context, size_t grain );
+
+/** !
+ * Sort a sized array in place. pfn_compare receives pointers to elements
+ *
+ * @param p_array     the array
+ * @param pfn_compare orders two elements
+ * @param p_context   passed to pfn_compare
+ *
+ * @sa array_sort
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int array_sized_sort ( array *const p_array, fn_array_compare *pfn_compare, void *const p_context );
+
+/** !
+ * Sort a sized array in place, keeping equal elements in order
+ *
+ * @param p_array     the array
+ * @param pfn_compare orders two elements
+ * @param p_context   passed to pfn_compare
+ *
+ * @sa array_sort_stable
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int array_sized_sort_stable ( array *const p_array, fn_array_compare *pfn_compare, void *const p_context );
+
 // Info
 /** !
  * Call function on every element in p_array
@@ -264,6 +1089,280 @@ DLLEXPORT int array_log ( array *p_array, void *pfn_next, const char *const form
  */
 DLLEXPORT int array_destroy ( array **const pp_array );
 
+// Arenas
+/** !
+ *  Construct an arena. Arrays constructed in the arena share its memory, and
+ *  are all released at once by array_arena_reset. An arena is not thread safe
+ *
+ * @param pp_arena   return
+ * @param chunk_size bytes the arena allocates at a time
+ *
+ * @sa array_arena_array
+ * @sa array_arena_destroy
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int array_arena_construct ( array_arena **const pp_arena, size_t chunk_size );
+
+/** !
+ *  Construct an unsynchronized sized array in an arena. The array's storage 
+ *  grows in place while it is the arena's most recent allocation. Calling 
+ *  array_destroy is optional, and must not happen after the arena is reset
+ *
+ * @param p_arena      the arena
+ * @param pp_array     return
+ * @param size         number of elements in an array
+ * @param element_size bytes in each element. Use sizeof(void *) for an array of pointers
+ *
+ * @sa array_arena_reset
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int array_arena_array ( array_arena *const p_arena, array **const pp_array, size_t size, size_t element_size );
+
+/** !
+ *  Release every array in an arena at once, without destroying them one by
+ *  one. The arena keeps its largest chunk for reuse
+ *
+ * @param p_arena the arena
+ *
+ * @sa array_arena_array
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int array_arena_reset ( array_arena *const p_arena );
+
+/** !
+ *  Release every array in an arena, and destroy the arena
+ *
+ * @param pp_arena the arena
+ *
+ * @sa array_arena_construct
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int array_arena_destroy ( array_arena **const pp_arena );
+
+// Pools
+/** !
+ *  Construct a pool. Arrays released to a pool keep their storage and their
+ *  lock, and are reused by the next array constructed from the pool. A pool 
+ *  is thread safe
+ *
+ * @param pp_pool  return
+ * @param capacity quantity of released arrays the pool can hold
+ *
+ * @sa array_pool_array
+ * @sa array_pool_release
+ * @sa array_pool_destroy
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int array_pool_construct ( array_pool **const pp_pool, size_t capacity );
+
+/** !
+ *  Construct a sized array from a pool. A released array with the same 
+ *  synchronization strategy is reused if there is one, else a new array is
+ *  constructed
+ *
+ * @param p_pool       the pool
+ * @param pp_array     return
+ * @param size         number of elements in an array
+ * @param element_size bytes in each element. Use sizeof(void *) for an array of pointers
+ * @param sync         the synchronization strategy
+ *
+ * @sa array_pool_release
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int array_pool_array ( array_pool *const p_pool, array **const pp_array, size_t size, size_t element_size, array_sync sync );
+
+/** !
+ *  Release an array to a pool, instead of destroying it. The array is emptied,
+ *  and its growth and shrink policies are reset. If the pool is full, or the 
+ *  array uses its own allocator, the array is destroyed
+ *
+ * @param p_pool   the pool
+ * @param pp_array pointer to the array
+ *
+ * @sa array_pool_array
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int array_pool_release ( array_pool *const p_pool, array **const pp_array );
+
+/** !
+ *  Get the quantity of arrays a pool reused, and the quantity it constructed
+ *
+ * @param p_pool   the pool
+ * @param p_hits   return, or null
+ * @param p_misses return, or null
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int array_pool_stats ( array_pool *const p_pool, size_t *const p_hits, size_t *const p_misses );
+
+/** !
+ *  Destroy every array released to a pool, and destroy the pool
+ *
+ * @param pp_pool the pool
+ *
+ * @sa array_pool_construct
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int array_pool_destroy ( array_pool **const pp_pool );
+
+// Pipelines
+/** !
+ *  Construct a lazy pipeline over the values of an array. Stages are added 
+ *  in order, and nothing runs until a terminal is called. Each terminal runs
+ *  every stage on one element before it reads the next, in a single pass 
+ *  under the shared lock of the array, without intermediate arrays. The 
+ *  array must outlive the pipeline, and a pipeline runs one terminal at a 
+ *  time. Stages receive the index of each element in the array. With 
+ *  ARRAY_SYNC_MUTEX and ARRAY_SYNC_SEQLOCK the shared lock is exclusive, so 
+ *  stages and terminals must not call any array function on the source
+ *
+ * @param pp_pipeline return
+ * @param p_array     the source
+ *
+ * @sa array_pipeline_destroy
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int array_pipeline_construct ( array_pipeline **const pp_pipeline, array *const p_array );
+
+/** !
+ *  Construct a lazy pipeline over pointers to the elements of a sized array
+ *
+ * @param pp_pipeline return
+ * @param p_array     the source
+ *
+ * @sa array_pipeline_construct
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int array_pipeline_construct_sized ( array_pipeline **const pp_pipeline, array *const p_array );
+
+/** !
+ *  Add a stage that drops the elements that fail a test
+ *
+ * @param p_pipeline the pipeline
+ * @param pfn_filter tests each element
+ * @param p_context  passed to pfn_filter
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int array_pipeline_filter ( array_pipeline *const p_pipeline, fn_array_filter *pfn_filter, void *const p_context );
+
+/** !
+ *  Add a stage that replaces each element with a value. pfn_map writes the 
+ *  value to the pointer it receives, and later stages receive the value
+ *
+ * @param p_pipeline the pipeline
+ * @param pfn_map    computes each element
+ * @param p_context  passed to pfn_map
+ *
+ * @sa array_map
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int array_pipeline_map ( array_pipeline *const p_pipeline, fn_array_map *pfn_map, void *const p_context );
+
+/** !
+ *  Add a stage that replaces each element with an element of element_size 
+ *  bytes. Later stages receive a pointer to it
+ *
+ * @param p_pipeline   the pipeline
+ * @param element_size bytes in each result
+ * @param pfn_map      computes each element
+ * @param p_context    passed to pfn_map
+ *
+ * @sa array_sized_map
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int array_pipeline_sized_map ( array_pipeline *const p_pipeline, size_t element_size, fn_array_map *pfn_map, void *const p_context );
+
+/** !
+ *  Add a stage that passes a quantity of elements, then ends the pipeline. 
+ *  The source is not read past the element that fills the take
+ *
+ * @param p_pipeline the pipeline
+ * @param count      elements to pass
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int array_pipeline_take ( array_pipeline *const p_pipeline, size_t count );
+
+/** !
+ *  Run a pipeline, and construct a new array of the elements that leave it. 
+ *  The new array has the synchronization strategy of the source
+ *
+ * @param p_pipeline the pipeline
+ * @param pp_result  return
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int array_pipeline_collect ( array_pipeline *const p_pipeline, array **const pp_result );
+
+/** !
+ *  Run a pipeline, and count the elements that leave it
+ *
+ * @param p_pipeline the pipeline
+ * @param p_count    return
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int array_pipeline_count ( array_pipeline *const p_pipeline, size_t *const p_count );
+
+/** !
+ *  Run a pipeline until an element leaves it, and stop scanning
+ *
+ * @param p_pipeline the pipeline
+ * @param p_value    return. A value is stored as a void *, an element is copied
+ *
+ * @return 1 if an element left the pipeline, 0 if none did, or on error
+ */
+DLLEXPORT int array_pipeline_first ( array_pipeline *const p_pipeline, void *const p_value );
+
+/** !
+ *  Run a pipeline, and call a function on each element that leaves it, in 
+ *  order, on the calling thread
+ *
+ * @param p_pipeline  the pipeline
+ * @param pfn_foreach the function
+ * @param p_context   passed to pfn_foreach
+ *
+ * @return 1 if every call returned nonzero, 0 on error
+ */
+DLLEXPORT int array_pipeline_foreach ( array_pipeline *const p_pipeline, fn_array_foreach_parallel *pfn_foreach, void *const p_context );
+
+/** !
+ *  Run a pipeline, and fold each element that leaves it into a result, in 
+ *  order, on the calling thread
+ *
+ * @param p_pipeline the pipeline
+ * @param p_result   the identity on entry, and the result on success
+ * @param pfn_reduce folds an element into the result
+ * @param p_context  passed to pfn_reduce
+ *
+ * @return 1 if every call returned nonzero, 0 on error
+ */
+DLLEXPORT int array_pipeline_reduce ( array_pipeline *const p_pipeline, void *const p_result, fn_array_reduce *pfn_reduce, void *const p_context );
+
+/** !
+ *  Destroy a pipeline. The source is not destroyed
+ *
+ * @param pp_pipeline the pipeline
+ *
+ * @sa array_pipeline_construct
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int array_pipeline_destroy ( array_pipeline **const pp_pipeline );
+
 // Cleanup
 /** !
  * This gets called at runtime after main
@@ -0,0 +1,68 @@
+/** !
+ * Time formatting shared by the array tester and benchmark
+ * 
+ * @file print_time.c
+ * 
+ * @author Jacob Smith
+ */
+
+// Include
+#include <stdio.h>
+
+// log module
+#include <log/log.h>
+
+// print_time
+#include "print_time.h"
+
+void print_time_pretty ( double seconds )
+{
+
+    // Initialized data
+    double _seconds     = seconds;
+    size_t days         = 0,
+           hours        = 0,
+           minutes      = 0,
+           __seconds    = 0,
+           milliseconds = 0,
+           microseconds = 0;
+
+    // Days
+    while ( _seconds > 86400.0 ) { days++;_seconds-=86400.0; };
+
+    // Hours
+    while ( _seconds > 3600.0 ) { hours++;_seconds-=3600.0; };
+
+    // Minutes
+    while ( _seconds > 60.0 ) { minutes++;_seconds-=60.0; };
+
+    // Seconds
+    while ( _seconds > 1.0 ) { __seconds++;_seconds-=1.0; };
+
+    // milliseconds
+    while ( _seconds > 0.001 ) { milliseconds++;_seconds-=0.001; };
+
+    // Microseconds
+    while ( _seconds > 0.000001 ) { microseconds++;_seconds-=0.000001; };
+
+    // Print days
+    if ( days ) log_info("%zu D, ", days);
+
+    // Print hours
+    if ( hours ) log_info("%zu h, ", hours);
+
+    // Print minutes
+    if ( minutes ) log_info("%zu m, ", minutes);
+
+    // Print seconds
+    if ( __seconds ) log_info("%zu s, ", __seconds);
+
+    // Print milliseconds
+    if ( milliseconds ) log_info("%zu ms, ", milliseconds);
+
+    // Print microseconds
+    if ( microseconds ) log_info("%zu us", microseconds);
+
+    // Done
+    return;
+}
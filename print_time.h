@@ -0,0 +1,19 @@
+/** !
+ * @file print_time.h 
+ * 
+ * @author Jacob Smith
+ * 
+ * Time formatting shared by the array tester and benchmark
+ */
+
+// Include guard
+#pragma once
+
+/** !
+ * Print the time formatted in days, hours, minutes, seconds, miliseconds, microseconds
+ * 
+ * @param seconds the time in seconds
+ * 
+ * @return void
+ */
+void print_time_pretty ( double seconds );